@@ -0,0 +1,118 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "benchmarkrunner.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <QTemporaryFile>
+#include <QTest>
+#include <QXmlStreamReader>
+
+namespace {
+
+// Reads the BenchmarkResult elements of a QtTest XML log
+QJsonArray readResults(QIODevice *device)
+{
+    QJsonArray results;
+    QString function;
+
+    QXmlStreamReader xml(device);
+    while (!xml.atEnd()) {
+        if (xml.readNext() != QXmlStreamReader::StartElement) {
+            continue;
+        }
+
+        const QXmlStreamAttributes attributes = xml.attributes();
+        if (xml.name() == QLatin1String("TestFunction")) {
+            function = attributes.value(QLatin1String("name")).toString();
+        } else if (xml.name() == QLatin1String("BenchmarkResult")) {
+            results.append(QJsonObject{
+                { QStringLiteral("function"), function },
+                { QStringLiteral("tag"), attributes.value(QLatin1String("tag")).toString() },
+                { QStringLiteral("metric"), attributes.value(QLatin1String("metric")).toString() },
+                { QStringLiteral("value"), attributes.value(QLatin1String("value")).toDouble() },
+                { QStringLiteral("iterations"), attributes.value(QLatin1String("iterations")).toInt() },
+            });
+        }
+    }
+    if (xml.hasError()) {
+        qWarning() << "Failed to read the benchmark results:" << xml.errorString();
+    }
+    return results;
+}
+
+}
+
+int runBenchmarks(QObject *testObject, int argc, char **argv)
+{
+    QStringList arguments;
+    arguments.reserve(argc);
+    for (int i = 0; i < argc; ++i) {
+        arguments.append(QString::fromLocal8Bit(argv[i]));
+    }
+
+    const int jsonIndex = arguments.indexOf(QLatin1String("-json"));
+    if (jsonIndex < 1) {
+        return QTest::qExec(testObject, arguments);
+    }
+    if (jsonIndex + 1 == arguments.size()) {
+        qCritical("-json needs a file name");
+        return 1;
+    }
+    const QString jsonFileName = arguments.takeAt(jsonIndex + 1);
+    arguments.removeAt(jsonIndex);
+
+    // QtTest has no JSON output, so log to XML and convert that afterwards
+    QTemporaryFile log;
+    if (!log.open()) {
+        qCritical() << "Failed to create a temporary file:" << log.errorString();
+        return 1;
+    }
+    arguments << QStringLiteral("-o") << QString(log.fileName() + QLatin1String(",xml"))
+              << QStringLiteral("-o") << QStringLiteral("-,txt");
+
+    const int failures = QTest::qExec(testObject, arguments);
+
+    log.seek(0);
+    const QJsonObject report{
+        { QStringLiteral("benchmark"), QFileInfo(QString::fromLocal8Bit(argv[0])).fileName() },
+        { QStringLiteral("version"), QStringLiteral(PACKAGEKITQT_VERSION) },
+        { QStringLiteral("qtVersion"), QString::fromLatin1(qVersion()) },
+        { QStringLiteral("cpu"), QSysInfo::currentCpuArchitecture() },
+        { QStringLiteral("date"), QDateTime::currentDateTimeUtc().toString(Qt::ISODate) },
+        { QStringLiteral("failures"), failures },
+        { QStringLiteral("results"), readResults(&log) },
+    };
+
+    QFile json(jsonFileName);
+    if (!json.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCritical() << "Failed to write" << jsonFileName << json.errorString();
+        return 1;
+    }
+    json.write(QJsonDocument(report).toJson());
+    return failures;
+}
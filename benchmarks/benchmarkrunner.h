@@ -0,0 +1,47 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include <QCoreApplication>
+#include <QObject>
+
+/**
+ * Runs the benchmarks of \p testObject like QTest::qExec() does
+ *
+ * On top of the usual QtTest options it accepts "-json <file>", which
+ * writes the results to \p file with one entry per benchmark and data
+ * row. Values are per iteration, in the unit of the metric used.
+ */
+int runBenchmarks(QObject *testObject, int argc, char **argv);
+
+/**
+ * Replaces QTEST_GUILESS_MAIN in benchmarks
+ */
+#define PK_BENCHMARK_MAIN(TestObject) \
+int main(int argc, char **argv) \
+{ \
+    QCoreApplication app(argc, argv); \
+    TestObject tc; \
+    return runBenchmarks(&tc, argc, argv); \
+}
+
+#endif
@@ -0,0 +1,369 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <QFile>
+#include <QMetaEnum>
+#include <QTimeZone>
+#include <QTest>
+
+#include <bitfield.h>
+#include <daemon.h>
+#include <details.h>
+#include <packagedetails.h>
+
+#include "benchmarkrunner.h"
+#include "isodate.h"
+
+using namespace PackageKit;
+
+namespace {
+
+// Gives access to the protected Transaction::parseError()
+class ErrorParser : public Transaction
+{
+public:
+    using Transaction::parseError;
+};
+
+QStringList readPackageIds(const QString &backend)
+{
+    QFile file(QLatin1String(BENCHMARK_DATA_DIR "/") + backend + QLatin1String("-package-ids.txt"));
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return QStringList();
+    }
+    return QString::fromUtf8(file.readAll()).split(QLatin1Char('\n'), Qt::SkipEmptyParts);
+}
+
+}
+
+/**
+ * The small helpers applications call for every package they show
+ *
+ * Package IDs come from data/, as reported by the dnf and apt backends.
+ */
+class ConversionBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void packageName_data();
+    void packageName();
+    void packageVersion_data();
+    void packageVersion();
+    void packageArch_data();
+    void packageArch();
+    void packageData_data();
+    void packageData();
+
+    void enumToString_data();
+    void enumToString();
+    void enumFromString_data();
+    void enumFromString();
+
+    void parseError();
+    void details();
+    void packageDetails();
+    void bitfield();
+    void isoDate_data();
+    void isoDate();
+
+private:
+    static void addPackageIds();
+    static void addEnums();
+    static QList<QVariantMap> detailsMaps();
+};
+
+void ConversionBenchmark::addPackageIds()
+{
+    QTest::addColumn<QStringList>("packageIds");
+
+    for (const QString &backend : { QStringLiteral("dnf"), QStringLiteral("apt") }) {
+        const QStringList packageIds = readPackageIds(backend);
+        QVERIFY2(!packageIds.isEmpty(), qPrintable(backend));
+        QTest::newRow(qPrintable(backend)) << packageIds;
+    }
+}
+
+void ConversionBenchmark::packageName_data()
+{
+    addPackageIds();
+}
+
+void ConversionBenchmark::packageName()
+{
+    QFETCH(QStringList, packageIds);
+
+    QBENCHMARK {
+        for (const QString &packageId : std::as_const(packageIds)) {
+            QVERIFY(!Transaction::packageName(packageId).isEmpty());
+        }
+    }
+}
+
+void ConversionBenchmark::packageVersion_data()
+{
+    addPackageIds();
+}
+
+void ConversionBenchmark::packageVersion()
+{
+    QFETCH(QStringList, packageIds);
+
+    QBENCHMARK {
+        for (const QString &packageId : std::as_const(packageIds)) {
+            QVERIFY(!Transaction::packageVersion(packageId).isEmpty());
+        }
+    }
+}
+
+void ConversionBenchmark::packageArch_data()
+{
+    addPackageIds();
+}
+
+void ConversionBenchmark::packageArch()
+{
+    QFETCH(QStringList, packageIds);
+
+    QBENCHMARK {
+        for (const QString &packageId : std::as_const(packageIds)) {
+            QVERIFY(!Transaction::packageArch(packageId).isEmpty());
+        }
+    }
+}
+
+void ConversionBenchmark::packageData_data()
+{
+    addPackageIds();
+}
+
+void ConversionBenchmark::packageData()
+{
+    QFETCH(QStringList, packageIds);
+
+    QBENCHMARK {
+        for (const QString &packageId : std::as_const(packageIds)) {
+            QVERIFY(!Transaction::packageData(packageId).isEmpty());
+        }
+    }
+}
+
+void ConversionBenchmark::addEnums()
+{
+    QTest::addColumn<QByteArray>("enumName");
+    QTest::addColumn<QList<int>>("values");
+
+    const QMetaObject &metaObject = Transaction::staticMetaObject;
+    for (const char *name : { "Role", "Status", "Info", "Group", "Error", "Filter" }) {
+        const QMetaEnum metaEnum = metaObject.enumerator(metaObject.indexOfEnumerator(name));
+        QList<int> values;
+        for (int i = 0; i < metaEnum.keyCount(); ++i) {
+            values.append(metaEnum.value(i));
+        }
+        QTest::newRow(name) << QByteArray(name) << values;
+    }
+}
+
+void ConversionBenchmark::enumToString_data()
+{
+    addEnums();
+}
+
+void ConversionBenchmark::enumToString()
+{
+    QFETCH(QByteArray, enumName);
+    QFETCH(QList<int>, values);
+
+    QBENCHMARK {
+        for (int value : std::as_const(values)) {
+            QVERIFY(!Daemon::enumToString<Transaction>(value, enumName.constData()).isEmpty());
+        }
+    }
+}
+
+void ConversionBenchmark::enumFromString_data()
+{
+    addEnums();
+}
+
+void ConversionBenchmark::enumFromString()
+{
+    QFETCH(QByteArray, enumName);
+    QFETCH(QList<int>, values);
+
+    QStringList strings;
+    for (int value : std::as_const(values)) {
+        strings.append(Daemon::enumToString<Transaction>(value, enumName.constData()));
+    }
+
+    QBENCHMARK {
+        for (int i = 0; i < strings.size(); ++i) {
+            QCOMPARE(Daemon::enumFromString<Transaction>(strings.at(i), enumName.constData()), values.at(i));
+        }
+    }
+}
+
+void ConversionBenchmark::parseError()
+{
+    const QStringList errors{
+        QStringLiteral("org.freedesktop.PackageKit.Transaction.PermissionDenied"),
+        QStringLiteral("org.freedesktop.PackageKit.Transaction.RefusedByPolicy"),
+        QStringLiteral("org.freedesktop.PackageKit.Transaction.PackageIdInvalid"),
+        QStringLiteral("org.freedesktop.PackageKit.Transaction.InputInvalid"),
+        QStringLiteral("org.freedesktop.PackageKit.Transaction.NoSuchFile"),
+        QStringLiteral("org.freedesktop.PackageKit.Transaction.NotSupported"),
+        QStringLiteral("org.freedesktop.packagekit.package-install"),
+    };
+
+    QBENCHMARK {
+        for (const QString &error : errors) {
+            QVERIFY(ErrorParser::parseError(error) != Transaction::InternalErrorFailed);
+        }
+    }
+}
+
+QList<QVariantMap> ConversionBenchmark::detailsMaps()
+{
+    QList<QVariantMap> maps;
+    const QStringList packageIds = readPackageIds(QStringLiteral("dnf"));
+    for (const QString &packageId : packageIds) {
+        maps.append(QVariantMap{
+            { QStringLiteral("package-id"), packageId },
+            { QStringLiteral("summary"), QString(QLatin1String("Summary of ") + packageId) },
+            { QStringLiteral("description"), QString(QLatin1String("Description of ") + packageId) },
+            { QStringLiteral("group"), uint(Transaction::GroupSystem) },
+            { QStringLiteral("url"), QStringLiteral("https://example.com") },
+            { QStringLiteral("license"), QStringLiteral("LGPL-2.1-or-later") },
+            { QStringLiteral("size"), qulonglong(1024 * 1024) },
+        });
+    }
+    return maps;
+}
+
+void ConversionBenchmark::details()
+{
+    QList<Details> details;
+    const QList<QVariantMap> maps = detailsMaps();
+    for (const QVariantMap &map : maps) {
+        details.append(map);
+    }
+
+    QBENCHMARK {
+        for (const Details &value : std::as_const(details)) {
+            QVERIFY(!value.packageId().isEmpty());
+            QVERIFY(!value.summary().isEmpty());
+            QVERIFY(!value.description().isEmpty());
+            QCOMPARE(value.group(), Transaction::GroupSystem);
+            QVERIFY(!value.url().isEmpty());
+            QVERIFY(!value.license().isEmpty());
+            QVERIFY(value.size() > 0);
+        }
+    }
+}
+
+void ConversionBenchmark::packageDetails()
+{
+    QList<PackageDetails> details;
+    const QList<QVariantMap> maps = detailsMaps();
+    for (const QVariantMap &map : maps) {
+        details.append(PackageDetails(map));
+    }
+
+    QBENCHMARK {
+        for (const PackageDetails &value : std::as_const(details)) {
+            QVERIFY(!value.packageId().isEmpty());
+            QVERIFY(!value.summary().isEmpty());
+            QVERIFY(!value.description().isEmpty());
+            QCOMPARE(value.group(), Transaction::GroupSystem);
+            QVERIFY(!value.url().isEmpty());
+            QVERIFY(!value.license().isEmpty());
+            QVERIFY(value.size() > 0);
+        }
+    }
+}
+
+void ConversionBenchmark::bitfield()
+{
+    QList<qulonglong> masks;
+    for (int i = 0; i < 64; ++i) {
+        masks.append(Q_UINT64_C(1) << i);
+    }
+
+    QBENCHMARK {
+        Bitfield roles;
+        for (qulonglong mask : std::as_const(masks)) {
+            roles |= mask;
+            roles |= Bitfield(mask);
+        }
+        for (qulonglong mask : std::as_const(masks)) {
+            QVERIFY(roles & mask);
+            QVERIFY((roles & Bitfield(mask)) == Bitfield(mask));
+        }
+    }
+}
+
+void ConversionBenchmark::isoDate_data()
+{
+    QTest::addColumn<QStringList>("dates");
+    QTest::addColumn<bool>("fast");
+
+    // The forms g_date_time_format_iso8601() produces
+    const QDateTime base(QDate(2026, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    QStringList utc;
+    QStringList fraction;
+    QStringList offset;
+    for (int i = 0; i < 1000; ++i) {
+        const QDateTime date = base.addSecs(qint64(i) * 3607);
+        utc.append(date.toString(Qt::ISODate));
+        fraction.append(date.addMSecs(i).toString(QStringLiteral("yyyy-MM-dd'T'HH:mm:ss.zzz'000Z'")));
+        offset.append(date.toOffsetFromUtc(7200).toString(Qt::ISODate));
+    }
+
+    for (bool fast : { false, true }) {
+        const char *parser = fast ? "IsoDate" : "QDateTime";
+        QTest::addRow("%s utc", parser) << utc << fast;
+        QTest::addRow("%s fraction", parser) << fraction << fast;
+        QTest::addRow("%s offset", parser) << offset << fast;
+    }
+}
+
+void ConversionBenchmark::isoDate()
+{
+    QFETCH(QStringList, dates);
+    QFETCH(bool, fast);
+
+    for (const QString &date : std::as_const(dates)) {
+        const QDateTime expected = QDateTime::fromString(date, Qt::ISODate);
+        QVERIFY2(expected.isValid(), qPrintable(date));
+        QCOMPARE(IsoDate::toDateTime(date), expected);
+        QCOMPARE(IsoDate::toMSecsSinceEpoch(date), expected.toMSecsSinceEpoch());
+    }
+
+    QBENCHMARK {
+        for (const QString &date : std::as_const(dates)) {
+            const qint64 msecs = fast ? IsoDate::toMSecsSinceEpoch(date)
+                                      : QDateTime::fromString(date, Qt::ISODate).toMSecsSinceEpoch();
+            QVERIFY(msecs > 0);
+        }
+    }
+}
+
+PK_BENCHMARK_MAIN(ConversionBenchmark)
+
+#include "conversionbenchmark.moc"
@@ -0,0 +1,258 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <QEventLoop>
+#include <QHash>
+#include <QTest>
+#include <QTimer>
+
+#include <daemon.h>
+#include <filelist.h>
+#include <transactionrecord.h>
+#include <updatedetail.h>
+
+#include "benchmarkrunner.h"
+#include "fakepackagekit.h"
+
+using namespace PackageKit;
+
+/**
+ * Round trips through the library against the fake daemon
+ *
+ * Everything from creating the transaction to its finished() signal is
+ * measured, so the numbers include the fake daemon producing the data.
+ * Compare them between builds on the same machine only.
+ */
+class TransactionBenchmark : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+
+    void packages_data();
+    void packages();
+    void updateDetails_data();
+    void updateDetails();
+    void files_data();
+    void files();
+    void propertyUpdates_data();
+    void propertyUpdates();
+    void latency();
+    void oldTransactions();
+
+private:
+    static Transaction::Exit run(Transaction *transaction);
+
+    FakePackageKit m_fake;
+};
+
+Transaction::Exit TransactionBenchmark::run(Transaction *transaction)
+{
+    Transaction::Exit exit = Transaction::ExitUnknown;
+    QEventLoop loop;
+    connect(transaction, &Transaction::finished, &loop, [&exit, &loop] (Transaction::Exit status) {
+        exit = status;
+        loop.quit();
+    });
+    QTimer::singleShot(60000, &loop, &QEventLoop::quit);
+    loop.exec();
+    return exit;
+}
+
+void TransactionBenchmark::initTestCase()
+{
+    QVERIFY2(m_fake.start(), qPrintable(m_fake.errorString()));
+    QTRY_VERIFY(Daemon::isRunning());
+}
+
+void TransactionBenchmark::packages_data()
+{
+    QTest::addColumn<uint>("packages");
+    QTest::addColumn<bool>("pluralSignals");
+
+    QTest::newRow("plural-1k") << 1000u << true;
+    QTest::newRow("plural-10k") << 10000u << true;
+    QTest::newRow("plural-100k") << 100000u << true;
+    QTest::newRow("single-1k") << 1000u << false;
+    QTest::newRow("single-10k") << 10000u << false;
+}
+
+void TransactionBenchmark::packages()
+{
+    QFETCH(uint, packages);
+    QFETCH(bool, pluralSignals);
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), packages },
+        { QStringLiteral("pluralSignals"), pluralSignals },
+    }));
+
+    QBENCHMARK {
+        uint received = 0;
+        Transaction *transaction = Daemon::getPackages();
+        connect(transaction, &Transaction::package, this, [&received] {
+            ++received;
+        });
+        QCOMPARE(run(transaction), Transaction::ExitSuccess);
+        QCOMPARE(received, packages);
+    }
+}
+
+void TransactionBenchmark::updateDetails_data()
+{
+    QTest::addColumn<uint>("updates");
+    QTest::addColumn<bool>("batched");
+
+    QTest::newRow("1k") << 1000u << false;
+    QTest::newRow("10k") << 10000u << false;
+    QTest::newRow("batched-1k") << 1000u << true;
+    QTest::newRow("batched-10k") << 10000u << true;
+}
+
+void TransactionBenchmark::updateDetails()
+{
+    QFETCH(uint, updates);
+    QFETCH(bool, batched);
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), updates },
+        { QStringLiteral("updates"), updates },
+    }));
+
+    QStringList packageIds;
+    packageIds.reserve(updates);
+    for (uint i = 0; i < updates; ++i) {
+        packageIds.append(FakeConfig::updateId(i));
+    }
+
+    QBENCHMARK {
+        uint received = 0;
+        Transaction *transaction = Daemon::getUpdatesDetails(packageIds);
+        if (batched) {
+            connect(transaction, &Transaction::updateDetails, this, [&received] (const QList<UpdateDetail> &details) {
+                received += details.size();
+            });
+        } else {
+            connect(transaction, &Transaction::updateDetail, this, [&received] {
+                ++received;
+            });
+        }
+        QCOMPARE(run(transaction), Transaction::ExitSuccess);
+        QCOMPARE(received, updates);
+    }
+}
+
+void TransactionBenchmark::files_data()
+{
+    QTest::addColumn<uint>("packages");
+    QTest::addColumn<bool>("fileList");
+
+    QTest::newRow("1k") << 1000u << false;
+    QTest::newRow("10k") << 10000u << false;
+    QTest::newRow("fileList-1k") << 1000u << true;
+    QTest::newRow("fileList-10k") << 10000u << true;
+}
+
+void TransactionBenchmark::files()
+{
+    QFETCH(uint, packages);
+    QFETCH(bool, fileList);
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), packages },
+        { QStringLiteral("filesPerPackage"), 20u },
+    }));
+
+    QStringList packageIds;
+    packageIds.reserve(packages);
+    for (uint i = 0; i < packages; ++i) {
+        packageIds.append(FakeConfig::packageId(i));
+    }
+
+    QBENCHMARK {
+        // Keep the results, like a client would
+        QList<FileList> lists;
+        QHash<QString, QStringList> strings;
+        Transaction *transaction = Daemon::getFiles(packageIds);
+        if (fileList) {
+            connect(transaction, &Transaction::fileList, this, [&lists] (const FileList &files) {
+                lists.append(files);
+            });
+        } else {
+            connect(transaction, &Transaction::files, this, [&strings] (const QString &packageID, const QStringList &files) {
+                strings.insert(packageID, files);
+            });
+        }
+        QCOMPARE(run(transaction), Transaction::ExitSuccess);
+
+        uint received = strings.size();
+        for (const FileList &files : std::as_const(lists)) {
+            received += files.packageCount();
+        }
+        QCOMPARE(received, packages);
+    }
+}
+
+void TransactionBenchmark::propertyUpdates_data()
+{
+    QTest::addColumn<uint>("updates");
+
+    QTest::newRow("1k") << 1000u;
+    QTest::newRow("10k") << 10000u;
+}
+
+void TransactionBenchmark::propertyUpdates()
+{
+    QFETCH(uint, updates);
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 0u },
+        { QStringLiteral("progressUpdates"), updates },
+    }));
+
+    QBENCHMARK {
+        QCOMPARE(run(Daemon::getPackages()), Transaction::ExitSuccess);
+    }
+}
+
+void TransactionBenchmark::latency()
+{
+    QVERIFY(m_fake.configure({ { QStringLiteral("packages"), 0u } }));
+
+    QBENCHMARK {
+        QCOMPARE(run(Daemon::getPackages()), Transaction::ExitSuccess);
+    }
+}
+
+void TransactionBenchmark::oldTransactions()
+{
+    QVERIFY(m_fake.configure({ { QStringLiteral("oldTransactions"), 5000u } }));
+
+    QBENCHMARK {
+        int received = 0;
+        Transaction *transaction = Daemon::getOldTransactions(5000);
+        connect(transaction, &Transaction::transactionRecords,
+                this, [&received] (const QList<TransactionRecord> &records) {
+            received += records.size();
+        });
+        QCOMPARE(run(transaction), Transaction::ExitSuccess);
+        QCOMPARE(received, 5000);
+    }
+}
+
+PK_BENCHMARK_MAIN(TransactionBenchmark)
+
+#include "transactionbenchmark.moc"
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_QML_H
+#define PACKAGEKIT_QML_H
+
+#include <QQmlEngine>
+
+#include <daemon.h>
+#include <packagemodel.h>
+#include <packageproxymodel.h>
+#include <transaction.h>
+
+namespace PackageKit {
+
+/**
+ * Daemon::global() as a singleton, its properties follow the daemon
+ */
+struct DaemonForeign
+{
+    Q_GADGET
+    QML_FOREIGN(PackageKit::Daemon)
+    QML_NAMED_ELEMENT(Daemon)
+    QML_SINGLETON
+public:
+    static Daemon *create(QQmlEngine *, QJSEngine *)
+    {
+        // Shared with C++, the engine must not delete it
+        Daemon *daemon = Daemon::global();
+        QJSEngine::setObjectOwnership(daemon, QJSEngine::CppOwnership);
+        return daemon;
+    }
+};
+
+struct TransactionForeign
+{
+    Q_GADGET
+    QML_FOREIGN(PackageKit::Transaction)
+    QML_NAMED_ELEMENT(Transaction)
+    QML_UNCREATABLE("Transactions are started with the Transactions singleton")
+};
+
+struct PackageModelForeign
+{
+    Q_GADGET
+    QML_FOREIGN(PackageKit::PackageModel)
+    QML_NAMED_ELEMENT(PackageModel)
+};
+
+struct PackageProxyModelForeign
+{
+    Q_GADGET
+    QML_FOREIGN(PackageKit::PackageProxyModel)
+    QML_NAMED_ELEMENT(PackageProxyModel)
+};
+
+} // End namespace PackageKit
+
+#endif
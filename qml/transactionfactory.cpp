@@ -0,0 +1,118 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactionfactory.h"
+
+#include <daemon.h>
+
+using namespace PackageKit;
+
+TransactionFactory::TransactionFactory(QObject *parent)
+    : QObject(parent)
+{
+}
+
+Transaction *TransactionFactory::getPackages(Transaction::Filters filters)
+{
+    return adopt(Daemon::getPackages(filters));
+}
+
+Transaction *TransactionFactory::getUpdates(Transaction::Filters filters)
+{
+    return adopt(Daemon::getUpdates(filters));
+}
+
+Transaction *TransactionFactory::getUpdatesDetails(const QStringList &packageIDs)
+{
+    return adopt(Daemon::getUpdatesDetails(packageIDs));
+}
+
+Transaction *TransactionFactory::getDetails(const QStringList &packageIDs)
+{
+    return adopt(Daemon::getDetails(packageIDs));
+}
+
+Transaction *TransactionFactory::getFiles(const QStringList &packageIDs)
+{
+    return adopt(Daemon::getFiles(packageIDs));
+}
+
+Transaction *TransactionFactory::getRepoList(Transaction::Filters filters)
+{
+    return adopt(Daemon::getRepoList(filters));
+}
+
+Transaction *TransactionFactory::resolve(const QStringList &packageNames, Transaction::Filters filters)
+{
+    return adopt(Daemon::resolve(packageNames, filters));
+}
+
+Transaction *TransactionFactory::searchNames(const QStringList &search, Transaction::Filters filters)
+{
+    return adopt(Daemon::searchNames(search, filters));
+}
+
+Transaction *TransactionFactory::searchDetails(const QStringList &search, Transaction::Filters filters)
+{
+    return adopt(Daemon::searchDetails(search, filters));
+}
+
+Transaction *TransactionFactory::searchFiles(const QStringList &search, Transaction::Filters filters)
+{
+    return adopt(Daemon::searchFiles(search, filters));
+}
+
+Transaction *TransactionFactory::whatProvides(const QStringList &search, Transaction::Filters filters)
+{
+    return adopt(Daemon::whatProvides(search, filters));
+}
+
+Transaction *TransactionFactory::installPackages(const QStringList &packageIDs)
+{
+    return adopt(Daemon::installPackages(packageIDs));
+}
+
+Transaction *TransactionFactory::removePackages(const QStringList &packageIDs, bool allowDeps, bool autoRemove)
+{
+    return adopt(Daemon::removePackages(packageIDs, allowDeps, autoRemove));
+}
+
+Transaction *TransactionFactory::updatePackages(const QStringList &packageIDs)
+{
+    return adopt(Daemon::updatePackages(packageIDs));
+}
+
+Transaction *TransactionFactory::refreshCache(bool force)
+{
+    return adopt(Daemon::refreshCache(force));
+}
+
+Transaction *TransactionFactory::repoEnable(const QString &repoId, bool enable)
+{
+    return adopt(Daemon::repoEnable(repoId, enable));
+}
+
+Transaction *TransactionFactory::adopt(Transaction *transaction)
+{
+    QJSEngine::setObjectOwnership(transaction, QJSEngine::CppOwnership);
+    return transaction;
+}
+
+#include "moc_transactionfactory.cpp"
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_FACTORY_H
+#define PACKAGEKIT_TRANSACTION_FACTORY_H
+
+#include <QObject>
+#include <QQmlEngine>
+
+#include <transaction.h>
+
+namespace PackageKit {
+
+/**
+ * Starts transactions from QML, as the Transactions singleton
+ *
+ * The methods match the static ones of Daemon. Transactions delete
+ * themselves once finished, so they are kept out of the reach of
+ * the JavaScript garbage collector.
+ */
+class TransactionFactory : public QObject
+{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(Transactions)
+    QML_SINGLETON
+public:
+    explicit TransactionFactory(QObject *parent = nullptr);
+
+    Q_INVOKABLE PackageKit::Transaction *getPackages(PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *getUpdates(PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *getUpdatesDetails(const QStringList &packageIDs);
+    Q_INVOKABLE PackageKit::Transaction *getDetails(const QStringList &packageIDs);
+    Q_INVOKABLE PackageKit::Transaction *getFiles(const QStringList &packageIDs);
+    Q_INVOKABLE PackageKit::Transaction *getRepoList(PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *resolve(const QStringList &packageNames, PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *searchNames(const QStringList &search, PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *searchDetails(const QStringList &search, PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *searchFiles(const QStringList &search, PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *whatProvides(const QStringList &search, PackageKit::Transaction::Filters filters = PackageKit::Transaction::FilterNone);
+    Q_INVOKABLE PackageKit::Transaction *installPackages(const QStringList &packageIDs);
+    Q_INVOKABLE PackageKit::Transaction *removePackages(const QStringList &packageIDs, bool allowDeps = false, bool autoRemove = false);
+    Q_INVOKABLE PackageKit::Transaction *updatePackages(const QStringList &packageIDs);
+    Q_INVOKABLE PackageKit::Transaction *refreshCache(bool force = false);
+    Q_INVOKABLE PackageKit::Transaction *repoEnable(const QString &repoId, bool enable = true);
+
+private:
+    static Transaction *adopt(Transaction *transaction);
+};
+
+} // End namespace PackageKit
+
+#endif
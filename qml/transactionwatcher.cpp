@@ -0,0 +1,209 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactionwatcher.h"
+
+#include <utility>
+
+using namespace PackageKit;
+
+TransactionWatcher::TransactionWatcher(QObject *parent)
+    : QObject(parent)
+{
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(16);
+    connect(&m_timer, &QTimer::timeout, this, &TransactionWatcher::apply);
+}
+
+Transaction *TransactionWatcher::transaction() const
+{
+    return m_transaction;
+}
+
+void TransactionWatcher::setTransaction(Transaction *transaction)
+{
+    if (m_transaction == transaction) {
+        return;
+    }
+
+    if (m_transaction) {
+        disconnect(m_transaction, nullptr, this, nullptr);
+    }
+    m_transaction = transaction;
+
+    if (transaction) {
+        for (auto signal : { &Transaction::roleChanged,
+                             &Transaction::statusChanged,
+                             &Transaction::percentageChanged,
+                             &Transaction::elapsedTimeChanged,
+                             &Transaction::remainingTimeChanged,
+                             &Transaction::speedChanged,
+                             &Transaction::downloadSizeRemainingChanged,
+                             &Transaction::allowCancelChanged,
+                             &Transaction::lastPackageChanged }) {
+            connect(transaction, signal, this, &TransactionWatcher::schedule);
+        }
+        connect(transaction, &Transaction::finished, this, &TransactionWatcher::transactionFinished);
+        connect(transaction, &QObject::destroyed, this, [this] {
+            m_timer.stop();
+            setRunning(false);
+            Q_EMIT transactionChanged();
+        });
+    }
+
+    Q_EMIT transactionChanged();
+    apply();
+    setRunning(transaction);
+}
+
+int TransactionWatcher::interval() const
+{
+    return m_timer.interval();
+}
+
+void TransactionWatcher::setInterval(int msecs)
+{
+    if (m_timer.interval() != msecs) {
+        m_timer.setInterval(msecs);
+        Q_EMIT intervalChanged();
+    }
+}
+
+bool TransactionWatcher::isRunning() const
+{
+    return m_running;
+}
+
+Transaction::Role TransactionWatcher::role() const
+{
+    return m_state.role;
+}
+
+Transaction::Status TransactionWatcher::status() const
+{
+    return m_state.status;
+}
+
+uint TransactionWatcher::percentage() const
+{
+    return m_state.percentage;
+}
+
+uint TransactionWatcher::elapsedTime() const
+{
+    return m_state.elapsedTime;
+}
+
+uint TransactionWatcher::remainingTime() const
+{
+    return m_state.remainingTime;
+}
+
+uint TransactionWatcher::speed() const
+{
+    return m_state.speed;
+}
+
+qulonglong TransactionWatcher::downloadSizeRemaining() const
+{
+    return m_state.downloadSizeRemaining;
+}
+
+bool TransactionWatcher::allowCancel() const
+{
+    return m_state.allowCancel;
+}
+
+QString TransactionWatcher::lastPackage() const
+{
+    return m_state.lastPackage;
+}
+
+void TransactionWatcher::schedule()
+{
+    if (!m_timer.isActive()) {
+        m_timer.start();
+    }
+}
+
+void TransactionWatcher::apply()
+{
+    m_timer.stop();
+
+    State state;
+    if (m_transaction) {
+        state.role = m_transaction->role();
+        state.status = m_transaction->status();
+        state.percentage = m_transaction->percentage();
+        state.elapsedTime = m_transaction->elapsedTime();
+        state.remainingTime = m_transaction->remainingTime();
+        state.speed = m_transaction->speed();
+        state.downloadSizeRemaining = m_transaction->downloadSizeRemaining();
+        state.allowCancel = m_transaction->allowCancel();
+        state.lastPackage = m_transaction->lastPackage();
+    }
+
+    // Assign everything first, so handlers see a consistent state
+    const State old = std::exchange(m_state, state);
+    if (old.role != state.role) {
+        Q_EMIT roleChanged();
+    }
+    if (old.status != state.status) {
+        Q_EMIT statusChanged();
+    }
+    if (old.percentage != state.percentage) {
+        Q_EMIT percentageChanged();
+    }
+    if (old.elapsedTime != state.elapsedTime) {
+        Q_EMIT elapsedTimeChanged();
+    }
+    if (old.remainingTime != state.remainingTime) {
+        Q_EMIT remainingTimeChanged();
+    }
+    if (old.speed != state.speed) {
+        Q_EMIT speedChanged();
+    }
+    if (old.downloadSizeRemaining != state.downloadSizeRemaining) {
+        Q_EMIT downloadSizeRemainingChanged();
+    }
+    if (old.allowCancel != state.allowCancel) {
+        Q_EMIT allowCancelChanged();
+    }
+    if (old.lastPackage != state.lastPackage) {
+        Q_EMIT lastPackageChanged();
+    }
+}
+
+void TransactionWatcher::setRunning(bool running)
+{
+    if (m_running != running) {
+        m_running = running;
+        Q_EMIT runningChanged();
+    }
+}
+
+void TransactionWatcher::transactionFinished(Transaction::Exit status, uint runtime)
+{
+    apply();
+    setRunning(false);
+    Q_EMIT finished(status, runtime);
+}
+
+#include "moc_transactionwatcher.cpp"
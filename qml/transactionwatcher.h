@@ -0,0 +1,123 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_WATCHER_H
+#define PACKAGEKIT_TRANSACTION_WATCHER_H
+
+#include <QObject>
+#include <QPointer>
+#include <QQmlEngine>
+#include <QTimer>
+
+#include <transaction.h>
+
+namespace PackageKit {
+
+/**
+ * Follows the progress of a transaction for bindings
+ *
+ * The daemon may change several properties of a transaction at once and
+ * many times per second, each change re-evaluating the bindings on it.
+ * The watcher collects the changes and applies them once per interval(),
+ * a frame at 60 fps by default, only notifying what really changed.
+ * finished() is forwarded right away, after the final values were applied.
+ */
+class TransactionWatcher : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(PackageKit::Transaction *transaction READ transaction WRITE setTransaction NOTIFY transactionChanged)
+    Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
+    Q_PROPERTY(bool running READ isRunning NOTIFY runningChanged)
+    Q_PROPERTY(PackageKit::Transaction::Role role READ role NOTIFY roleChanged)
+    Q_PROPERTY(PackageKit::Transaction::Status status READ status NOTIFY statusChanged)
+    Q_PROPERTY(uint percentage READ percentage NOTIFY percentageChanged)
+    Q_PROPERTY(uint elapsedTime READ elapsedTime NOTIFY elapsedTimeChanged)
+    Q_PROPERTY(uint remainingTime READ remainingTime NOTIFY remainingTimeChanged)
+    Q_PROPERTY(uint speed READ speed NOTIFY speedChanged)
+    Q_PROPERTY(qulonglong downloadSizeRemaining READ downloadSizeRemaining NOTIFY downloadSizeRemainingChanged)
+    Q_PROPERTY(bool allowCancel READ allowCancel NOTIFY allowCancelChanged)
+    Q_PROPERTY(QString lastPackage READ lastPackage NOTIFY lastPackageChanged)
+public:
+    explicit TransactionWatcher(QObject *parent = nullptr);
+
+    Transaction *transaction() const;
+    void setTransaction(Transaction *transaction);
+
+    int interval() const;
+    void setInterval(int msecs);
+
+    /**
+     * True from setTransaction() until the transaction finished
+     */
+    bool isRunning() const;
+
+    Transaction::Role role() const;
+    Transaction::Status status() const;
+    uint percentage() const;
+    uint elapsedTime() const;
+    uint remainingTime() const;
+    uint speed() const;
+    qulonglong downloadSizeRemaining() const;
+    bool allowCancel() const;
+    QString lastPackage() const;
+
+Q_SIGNALS:
+    void transactionChanged();
+    void intervalChanged();
+    void runningChanged();
+    void roleChanged();
+    void statusChanged();
+    void percentageChanged();
+    void elapsedTimeChanged();
+    void remainingTimeChanged();
+    void speedChanged();
+    void downloadSizeRemainingChanged();
+    void allowCancelChanged();
+    void lastPackageChanged();
+    void finished(PackageKit::Transaction::Exit status, uint runtime);
+
+private:
+    struct State {
+        Transaction::Role role = Transaction::RoleUnknown;
+        Transaction::Status status = Transaction::StatusUnknown;
+        uint percentage = 101;
+        uint elapsedTime = 0;
+        uint remainingTime = 0;
+        uint speed = 0;
+        qulonglong downloadSizeRemaining = 0;
+        bool allowCancel = false;
+        QString lastPackage;
+    };
+
+    void schedule();
+    void apply();
+    void setRunning(bool running);
+    void transactionFinished(Transaction::Exit status, uint runtime);
+
+    QPointer<Transaction> m_transaction;
+    QTimer m_timer;
+    State m_state;
+    bool m_running = false;
+};
+
+} // End namespace PackageKit
+
+#endif
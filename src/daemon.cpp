@@ -25,6 +25,17 @@
 #include "daemonproxy.h"
 
 #include "common.h"
+#include "filelist.h"
+#include "metricsprivate.h"
+#include "packagedetails.h"
+#include "transactiondecoder.h"
+#include "tracing.h"
+
+#include <QMutex>
+#include <QThread>
+
+#include <mutex>
+#include <optional>
 
 Q_LOGGING_CATEGORY(PACKAGEKITQT_DAEMON, "packagekitqt.daemon")
 Q_LOGGING_CATEGORY(PACKAGEKITQT_OFFLINE, "packagekitqt.offline")
@@ -33,6 +44,7 @@ Q_DECLARE_METATYPE(PackageKit::PkPackage);
 Q_DECLARE_METATYPE(QList<PackageKit::PkPackage>);
 Q_DECLARE_METATYPE(PackageKit::PkDetail);
 Q_DECLARE_METATYPE(QList<PackageKit::PkDetail>);
+Q_DECLARE_METATYPE(PackageKit::PkFiles);
 
 static const QDBusArgument &operator<<(QDBusArgument &argument, const PackageKit::PkPackage &pkg)
 {
@@ -51,9 +63,20 @@ static const QDBusArgument &operator>>(const QDBusArgument &argument, PackageKit
     argument >> pkg.pid;
     argument >> pkg.summary;
     argument.endStructure();
+    PackageKit::MetricsPrivate::add(PackageKit::MetricsPrivate::BytesDecoded,
+                                    sizeof(uint) + pkg.pid.size() + pkg.summary.size());
     return argument;
 }
 
+static quint64 decodedSize(const QStringList &list)
+{
+    quint64 size = 0;
+    for (const QString &string : list) {
+        size += string.size();
+    }
+    return size;
+}
+
 static const QDBusArgument &operator>>(const QDBusArgument &argument, PackageKit::PkDetail &detail)
 {
     argument.beginStructure();
@@ -70,6 +93,20 @@ static const QDBusArgument &operator>>(const QDBusArgument &argument, PackageKit
     argument >> detail.issued;
     argument >> detail.updated;
     argument.endStructure();
+    if (PackageKit::MetricsPrivate::isEnabled()) {
+        PackageKit::MetricsPrivate::add(PackageKit::MetricsPrivate::BytesDecoded,
+                                        2 * sizeof(uint)
+                                        + detail.package_id.size()
+                                        + decodedSize(detail.updates)
+                                        + decodedSize(detail.obsoletes)
+                                        + decodedSize(detail.vendor_urls)
+                                        + decodedSize(detail.bugzilla_urls)
+                                        + decodedSize(detail.cve_urls)
+                                        + detail.update_text.size()
+                                        + detail.changelog.size()
+                                        + detail.issued.size()
+                                        + detail.updated.size());
+    }
     return argument;
 }
 
@@ -92,15 +129,113 @@ static const QDBusArgument &operator<<(QDBusArgument &argument, const PackageKit
     return argument;
 }
 
+// The a{sv} of the Details signal, read into the fields directly
+static const QDBusArgument &operator>>(const QDBusArgument &argument, PackageKit::PackageDetails &details)
+{
+    details = PackageKit::PackageDetails(QVariantMap());
+    argument.beginMap();
+    while (!argument.atEnd()) {
+        QString key;
+        QDBusVariant value;
+        argument.beginMapEntry();
+        argument >> key >> value;
+        argument.endMapEntry();
+        details.insert(key, value.variant());
+    }
+    argument.endMap();
+    return argument;
+}
+
+static const QDBusArgument &operator<<(QDBusArgument &argument, const PackageKit::PackageDetails &details)
+{
+    argument << details.toVariantMap();
+    return argument;
+}
+
+// The a(sas) of the FileLists signal, the paths go to the list one by one
+static const QDBusArgument &operator>>(const QDBusArgument &argument, PackageKit::FileList &files)
+{
+    files.clear();
+    quint64 size = 0;
+    argument.beginArray();
+    while (!argument.atEnd()) {
+        QString packageID;
+        argument.beginStructure();
+        argument >> packageID;
+        files.addPackage(packageID);
+        size += packageID.size();
+
+        argument.beginArray();
+        while (!argument.atEnd()) {
+            QString file;
+            argument >> file;
+            files.addFile(file);
+            size += file.size();
+        }
+        argument.endArray();
+        argument.endStructure();
+    }
+    argument.endArray();
+    PackageKit::MetricsPrivate::add(PackageKit::MetricsPrivate::BytesDecoded, size);
+    return argument;
+}
+
+static const QDBusArgument &operator<<(QDBusArgument &argument, const PackageKit::PkFiles &files)
+{
+    argument.beginStructure();
+    argument << files.pid;
+    argument << files.files;
+    argument.endStructure();
+    return argument;
+}
+
+static const QDBusArgument &operator>>(const QDBusArgument &argument, PackageKit::PkFiles &files)
+{
+    argument.beginStructure();
+    argument >> files.pid;
+    argument >> files.files;
+    argument.endStructure();
+    return argument;
+}
+
+static const QDBusArgument &operator<<(QDBusArgument &argument, const PackageKit::FileList &files)
+{
+    argument.beginArray(QMetaType::fromType<PackageKit::PkFiles>());
+    for (int i = 0; i < files.packageCount(); ++i) {
+        argument << PackageKit::PkFiles{ files.packageID(i), files.files(i) };
+    }
+    argument.endArray();
+    return argument;
+}
+
 using namespace PackageKit;
 
 Daemon* Daemon::m_global = nullptr;
 
+// Set by Daemon::setConnection() before the global instance exists
+static std::optional<QDBusConnection> s_initialConnection;
+// Guards the two above, setConnection() may race with the creation of the instance
+static QBasicMutex s_globalMutex;
+
 Daemon* Daemon::global()
 {
-    if(!m_global) {
-        m_global = new Daemon(qApp);
-    }
+    static std::once_flag created;
+    std::call_once(created, [] {
+        QMutexLocker locker(&s_globalMutex);
+        if (!qApp || QThread::currentThread() == qApp->thread()) {
+            m_global = new Daemon(qApp);
+            return;
+        }
+
+        // Created from a worker thread, it still has to live in the main
+        // one like everything owned by the application object
+        auto daemon = new Daemon(nullptr);
+        daemon->moveToThread(qApp->thread());
+        QMetaObject::invokeMethod(qApp, [daemon] {
+            daemon->setParent(qApp);
+        }, Qt::QueuedConnection);
+        m_global = daemon;
+    });
 
     return m_global;
 }
@@ -110,22 +245,65 @@ Daemon::Daemon(QObject *parent) :
     d_ptr(new DaemonPrivate(this))
 {
     Q_D(Daemon);
-    d->daemon = new ::OrgFreedesktopPackageKitInterface(PK_NAME,
-                                                        PK_PATH,
-                                                        QDBusConnection::systemBus(),
-                                                        this);
-
-    QDBusConnection::systemBus().connect(PK_NAME,
-                                         PK_PATH,
-                                         DBUS_PROPERTIES,
-                                         QLatin1String("PropertiesChanged"),
-                                         this,
-                                         SLOT(propertiesChanged(QString,QVariantMap,QStringList)));
 
     qDBusRegisterMetaType<PackageKit::PkPackage>();
     qDBusRegisterMetaType<QList<PackageKit::PkPackage>>();
     qDBusRegisterMetaType<PackageKit::PkDetail>();
     qDBusRegisterMetaType<QList<PackageKit::PkDetail>>();
+    qDBusRegisterMetaType<PackageKit::PackageDetails>();
+    qDBusRegisterMetaType<PackageKit::PkFiles>();
+    qDBusRegisterMetaType<PackageKit::FileList>();
+
+    const QString traceFile = qEnvironmentVariable("PACKAGEKITQT_TRACE_FILE");
+    if (!traceFile.isEmpty()) {
+        Tracing::start(traceFile);
+    }
+
+    if (s_initialConnection) {
+        d->setConnection(*s_initialConnection);
+        s_initialConnection.reset();
+    } else {
+        d->setConnection(QDBusConnection::systemBus(), QDBusConnection::SystemBus);
+    }
+}
+
+void Daemon::setConnection(const QDBusConnection &connection)
+{
+    Daemon *daemon;
+    {
+        QMutexLocker locker(&s_globalMutex);
+        if (!m_global) {
+            s_initialConnection = connection;
+            return;
+        }
+        daemon = m_global;
+    }
+
+    // The proxies owned by the instance are replaced on its thread
+    if (QThread::currentThread() == daemon->thread()) {
+        daemon->d_ptr->setConnection(connection);
+    } else {
+        QMetaObject::invokeMethod(daemon, [daemon, connection] {
+            daemon->d_ptr->setConnection(connection);
+        }, Qt::BlockingQueuedConnection);
+    }
+}
+
+QDBusConnection Daemon::connection()
+{
+    DaemonPrivate *d = global()->d_ptr;
+    QMutexLocker locker(&d->connectionMutex);
+    return d->connection;
+}
+
+void Daemon::setThreadedDecoding(bool enabled)
+{
+    TransactionDecoder::setEnabled(enabled);
+}
+
+bool Daemon::threadedDecoding()
+{
+    return TransactionDecoder::isEnabled();
 }
 
 void DaemonPrivate::setupSignal(const QMetaMethod &signal)
@@ -230,21 +408,25 @@ QString Daemon::distroID()
 
 QDBusPendingReply<Daemon::Authorize> Daemon::canAuthorize(const QString &actionId)
 {
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
     return global()->d_ptr->daemon->CanAuthorize(actionId);
 }
 
 QDBusPendingReply<QDBusObjectPath> Daemon::createTransaction()
 {
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
     return global()->d_ptr->daemon->CreateTransaction();
 }
 
 QDBusPendingReply<uint> Daemon::getTimeSinceAction(Transaction::Role role)
 {
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
     return global()->d_ptr->daemon->GetTimeSinceAction(role);
 }
 
 QDBusPendingReply<QList<QDBusObjectPath> > Daemon::getTransactionList()
 {
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
     return global()->d_ptr->daemon->GetTransactionList();
 }
 
@@ -265,16 +447,19 @@ QStringList Daemon::hints()
 
 QDBusPendingReply<> Daemon::setProxy(const QString& http_proxy, const QString& https_proxy, const QString& ftp_proxy, const QString& socks_proxy, const QString& no_proxy, const QString& pac)
 {
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
     return global()->d_ptr->daemon->SetProxy(http_proxy, https_proxy, ftp_proxy, socks_proxy, no_proxy, pac);
 }
 
 QDBusPendingReply<> Daemon::stateHasChanged(const QString& reason)
 {
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
     return global()->d_ptr->daemon->StateHasChanged(reason);
 }
 
 QDBusPendingReply<> Daemon::suggestDaemonQuit()
 {
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
     return global()->d_ptr->daemon->SuggestDaemonQuit();
 }
 
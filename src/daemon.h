@@ -24,6 +24,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QMetaEnum>
+#include <QtDBus/QDBusConnection>
 #include <QtDBus/QDBusError>
 #include <QtDBus/QDBusPendingReply>
 
@@ -49,6 +50,13 @@ class Offline;
  * This class is a singleton, its constructor is private. Call Daemon::global() to get
  * an instance of the Daemon object, you only need Daemon::global() when connecting to the signals
  * of this class.
+ *
+ * Transactions can be created from any thread running an event loop, a
+ * worker of a QThreadPool included, and deliver their signals there. Such
+ * threads get a connection to the system bus of their own on first use,
+ * so they don't contend with the main thread. The singleton itself always
+ * lives in the main thread. Call setConnection() and setHints() before
+ * other threads start using the library.
  */
 class DaemonPrivate;
 class PACKAGEKITQT_LIBRARY Daemon : public QObject
@@ -98,11 +106,66 @@ public:
      * \brief Returns an instance of the Daemon
      *
      * The Daemon class is a singleton, you can call this method several times,
-     * a single Daemon object will exist.
+     * a single Daemon object will exist. It is safe to call from any thread.
      * Use this only when connecting to this class signals
      */
     static Daemon* global();
 
+    /**
+     * \brief Sets the D-Bus connection used to talk to PackageKit
+     *
+     * By default the library uses the system bus. This can be a private bus
+     * running a stand-in daemon for tests and benchmarks, or a dedicated
+     * connection that keeps PackageKit traffic away from the application's
+     * main one.
+     *
+     * Transactions created afterwards use \p connection, the ones already
+     * running keep the connection they were created on. Daemon properties
+     * are fetched again from the new connection.
+     *
+     * When called before global() is first used, the system bus is not
+     * touched at all.
+     *
+     * It is safe to call from any thread. Once global() exists, a call from
+     * another thread blocks until the main thread has switched over, so the
+     * main thread must be running its event loop and not wait on the caller.
+     *
+     * \sa connection()
+     */
+    static void setConnection(const QDBusConnection &connection);
+
+    /**
+     * Returns the D-Bus connection used to talk to PackageKit
+     *
+     * \sa setConnection()
+     */
+    static QDBusConnection connection();
+
+    /**
+     * \brief Decodes the results of transactions on a library-owned thread
+     *
+     * Large results, like the packages of getPackages() or the details of
+     * getUpdatesDetails(), take a while to demarshal. By default that
+     * happens on the thread the Transaction lives in, usually the GUI one.
+     * When enabled, transactions set up afterwards receive their plural
+     * Packages, UpdateDetails and FileLists signals on a worker thread
+     * instead, which also parses the dates of update details. The thread
+     * of the Transaction then only gets the finished batches and emits
+     * package(), updateDetail() and files() from them.
+     *
+     * Disabled by default.
+     *
+     * \sa threadedDecoding()
+     */
+    static void setThreadedDecoding(bool enabled);
+
+    /**
+     * Returns whether new transactions decode their results on a worker thread
+     *
+     * \sa setThreadedDecoding()
+     */
+    static bool threadedDecoding();
+
     /**
      * Destructor
      */
@@ -448,7 +511,7 @@ public:
      * \brief Gets the last \p number finished transactions
      *
      * \note You must delete these transactions yourself
-     * \note This method emits \sa transaction()
+     * \note This method emits \sa transaction() and \sa transactionRecords()
      *
      * \warning check \sa errorCode() signal to know if it the call has any error
      */
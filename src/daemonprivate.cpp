@@ -22,6 +22,8 @@
 #include "daemonprivate.h"
 #include "transaction.h"
 #include "common.h"
+#include "metricsprivate.h"
+#include "tracingprivate.h"
 
 #include "offline_p.h"
 
@@ -30,22 +32,74 @@
 #include <QDBusMessage>
 #include <QDBusArgument>
 #include <QDBusReply>
+#include <QThread>
 
 using namespace PackageKit;
 
 DaemonPrivate::DaemonPrivate(Daemon* parent)
     : q_ptr(parent)
+    , connection(QString())
     , offline(new Offline(parent))
+{
+}
+
+void DaemonPrivate::setConnection(const QDBusConnection &newConnection,
+                                  std::optional<QDBusConnection::BusType> newBusType)
 {
     Q_Q(Daemon);
+    // The proxies below are children of q
+    Q_ASSERT(QThread::currentThread() == q->thread());
+    PK_TRACE_INSTANT("Daemon::setConnection", "connection", newConnection.name());
+
+    if (daemon) {
+        connection.disconnect(PK_NAME,
+                              PK_PATH,
+                              DBUS_PROPERTIES,
+                              QLatin1String("PropertiesChanged"),
+                              q,
+                              SLOT(propertiesChanged(QString,QVariantMap,QStringList)));
+        connection.disconnect(PK_NAME,
+                              PK_PATH,
+                              DBUS_PROPERTIES,
+                              QLatin1String("PropertiesChanged"),
+                              offline,
+                              SLOT(updateProperties(QString,QVariantMap,QStringList)));
+        delete daemon;
+        delete watcher;
+    }
+    {
+        QMutexLocker locker(&connectionMutex);
+        connection = newConnection;
+        busType = newBusType;
+        ++connectionGeneration;
+    }
+
+    daemon = new ::OrgFreedesktopPackageKitInterface(PK_NAME,
+                                                     PK_PATH,
+                                                     connection,
+                                                     q);
 
-    auto watcher = new QDBusServiceWatcher(PK_NAME,
-                                           QDBusConnection::systemBus(),
-                                           QDBusServiceWatcher::WatchForOwnerChange,
-                                           q_ptr);
+    connection.connect(PK_NAME,
+                       PK_PATH,
+                       DBUS_PROPERTIES,
+                       QLatin1String("PropertiesChanged"),
+                       q,
+                       SLOT(propertiesChanged(QString,QVariantMap,QStringList)));
+    connection.connect(PK_NAME,
+                       PK_PATH,
+                       DBUS_PROPERTIES,
+                       QLatin1String("PropertiesChanged"),
+                       offline,
+                       SLOT(updateProperties(QString,QVariantMap,QStringList)));
+
+    watcher = new QDBusServiceWatcher(PK_NAME,
+                                      connection,
+                                      QDBusServiceWatcher::WatchForOwnerChange,
+                                      q);
     q->connect(watcher, &QDBusServiceWatcher::serviceOwnerChanged,
                    q, [this, q] (const QString &service, const QString &oldOwner, const QString &newOwner) {
         Q_UNUSED(service)
+        PK_TRACE_INSTANT("serviceOwnerChanged", "owner", newOwner);
         if (newOwner.isEmpty() || !oldOwner.isEmpty()) {
             // TODO check if we don't emit this twice when
             // the daemon exits cleanly
@@ -69,9 +123,66 @@ DaemonPrivate::DaemonPrivate(Daemon* parent)
         }
     });
 
+    // Signals already in use have to come from the new proxy
+    for (const QMetaMethod &signal : std::as_const(connectedSignals)) {
+        setupSignal(signal);
+    }
+
     getAllProperties();
 }
 
+namespace {
+
+struct ThreadConnection
+{
+    ~ThreadConnection()
+    {
+        if (!name.isEmpty()) {
+            QDBusConnection::disconnectFromBus(name);
+        }
+    }
+
+    QString name;
+    uint generation = 0;
+};
+
+}
+
+QDBusConnection DaemonPrivate::threadConnection()
+{
+    Daemon *daemon = Daemon::global();
+    DaemonPrivate *d = daemon->d_ptr;
+    if (QThread::currentThread() == daemon->thread()) {
+        return d->connection;
+    }
+
+    // Daemon::setConnection() may change them meanwhile
+    QDBusConnection connection(QString());
+    std::optional<QDBusConnection::BusType> busType;
+    uint generation;
+    {
+        QMutexLocker locker(&d->connectionMutex);
+        connection = d->connection;
+        busType = d->busType;
+        generation = d->connectionGeneration;
+    }
+    if (!busType) {
+        // Connections handed to setConnection() can't be opened again, they are thread-safe though
+        return connection;
+    }
+
+    thread_local ThreadConnection local;
+    if (local.name.isEmpty() || local.generation != generation) {
+        if (!local.name.isEmpty()) {
+            QDBusConnection::disconnectFromBus(local.name);
+        }
+        local.name = QLatin1String("packagekitqt-") + QString::number(quintptr(QThread::currentThread()), 16);
+        local.generation = generation;
+        return QDBusConnection::connectToBus(*busType, local.name);
+    }
+    return QDBusConnection(local.name);
+}
+
 void DaemonPrivate::getAllProperties()
 {
     Q_Q(Daemon);
@@ -81,24 +192,27 @@ void DaemonPrivate::getAllProperties()
                                                           DBUS_PROPERTIES,
                                                           QLatin1String("GetAll"));
     message << PK_NAME;
-    QDBusConnection::systemBus().callWithCallback(message,
-                                                  q,
-                                                  SLOT(updateProperties(QVariantMap)));
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    connection.callWithCallback(message,
+                                q,
+                                SLOT(updateProperties(QVariantMap)));
 
     message = QDBusMessage::createMethodCall(PK_NAME,
                                              PK_PATH,
                                              DBUS_PROPERTIES,
                                              QLatin1String("GetAll"));
     message << PK_OFFLINE_INTERFACE;
-    QDBusConnection::systemBus().callWithCallback(message,
-                                                  offline,
-                                                  SLOT(initializeProperties(QVariantMap)));
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    connection.callWithCallback(message,
+                                offline,
+                                SLOT(initializeProperties(QVariantMap)));
 }
 
 void DaemonPrivate::propertiesChanged(const QString &interface, const QVariantMap &properties, const QStringList &invalidatedProperties)
 {
     Q_UNUSED(invalidatedProperties)
 
+    MetricsPrivate::add(MetricsPrivate::SignalsReceived);
     if (interface == PK_NAME) {
         updateProperties(properties);
     } else if (interface == PK_OFFLINE_INTERFACE) {
@@ -111,6 +225,8 @@ void DaemonPrivate::propertiesChanged(const QString &interface, const QVariantMa
 void DaemonPrivate::updateProperties(const QVariantMap &properties)
 {
     Q_Q(Daemon);
+    PK_TRACE_SCOPE(traceScope, "Daemon::updateProperties");
+    PK_TRACE_SCOPE_ARG(traceScope, "properties", properties.size());
 
     if (!running) {
         running = true;
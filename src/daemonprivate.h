@@ -24,6 +24,10 @@
 
 #include <QStringList>
 #include <QLoggingCategory>
+#include <QDBusConnection>
+#include <QMutex>
+
+#include <optional>
 
 #include "daemon.h"
 #include "offline.h"
@@ -32,6 +36,7 @@ Q_DECLARE_LOGGING_CATEGORY(PACKAGEKITQT_DAEMON)
 Q_DECLARE_LOGGING_CATEGORY(PACKAGEKITQT_OFFLINE)
 
 class OrgFreedesktopPackageKitInterface;
+class QDBusServiceWatcher;
 
 namespace PackageKit {
 
@@ -50,10 +55,28 @@ protected:
     virtual ~DaemonPrivate() {}
 
     Daemon *q_ptr;
-    ::OrgFreedesktopPackageKitInterface *daemon;
+    ::OrgFreedesktopPackageKitInterface *daemon = nullptr;
+    QDBusServiceWatcher *watcher = nullptr;
+    QDBusConnection connection;
     QStringList hints;
     QList<QMetaMethod> connectedSignals;
 
+    // Set when connection is a well-known bus other threads can open
+    // connections of their own to, see threadConnection()
+    std::optional<QDBusConnection::BusType> busType;
+    // Bumped by setConnection() so threads drop their old connections
+    uint connectionGeneration = 0;
+    // Guards the three above, other threads read them in threadConnection()
+    mutable QMutex connectionMutex;
+
+    void setConnection(const QDBusConnection &newConnection,
+                       std::optional<QDBusConnection::BusType> newBusType = std::nullopt);
+
+    /**
+     * Returns the connection transactions created on the calling thread use,
+     * a thread-local one for threads other than the Daemon's
+     */
+    static QDBusConnection threadConnection();
     void setupSignal(const QMetaMethod &signal);
     void getAllProperties();
 
@@ -0,0 +1,384 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "detailsprefetcher.h"
+
+#include "daemon.h"
+
+#include <QCache>
+#include <QHash>
+#include <QPointer>
+#include <QSet>
+#include <QTimer>
+
+#include <algorithm>
+
+namespace PackageKit {
+
+class DetailsPrefetcherPrivate
+{
+    Q_DECLARE_PUBLIC(DetailsPrefetcher)
+public:
+    struct Batch {
+        QPointer<Transaction> transaction;
+        QStringList packageIds;
+        bool cancelled = false;
+    };
+
+    DetailsPrefetcherPrivate(DetailsPrefetcher *parent) : q_ptr(parent) {}
+
+    void enqueue(const QString &packageID);
+    void flush();
+    void batchFinished(Transaction *transaction);
+    Batch *findBatch(Transaction *transaction);
+    bool inWindow(const QString &packageID) const;
+    void updateBusy();
+
+    DetailsPrefetcher *q_ptr;
+    QTimer timer;
+    QStringList packageIds;
+    QHash<QString, int> rows;
+    QCache<QString, PackageDetails> cache{5000};
+    // Not sent yet, in order
+    QStringList queue;
+    // Everything queued or in a running batch
+    QSet<QString> requested;
+    QList<Batch> batches;
+    int batchSize = 200;
+    int prefetchCount = 40;
+    // The rows worth fetching, -1 when no range was set
+    int windowFirst = -1;
+    int windowLast = -1;
+    int lastFirst = -1;
+    bool forward = true;
+    bool busy = false;
+};
+
+}
+
+using namespace PackageKit;
+
+DetailsPrefetcher::DetailsPrefetcher(QObject *parent)
+    : QObject(parent)
+    , d_ptr(new DetailsPrefetcherPrivate(this))
+{
+    Q_D(DetailsPrefetcher);
+    d->timer.setSingleShot(true);
+    d->timer.setInterval(16);
+    connect(&d->timer, &QTimer::timeout, this, [d] {
+        d->flush();
+    });
+}
+
+DetailsPrefetcher::~DetailsPrefetcher()
+{
+    delete d_ptr;
+}
+
+QStringList DetailsPrefetcher::packageIds() const
+{
+    Q_D(const DetailsPrefetcher);
+    return d->packageIds;
+}
+
+void DetailsPrefetcher::setPackageIds(const QStringList &packageIds)
+{
+    Q_D(DetailsPrefetcher);
+    d->packageIds = packageIds;
+    d->rows.clear();
+    d->rows.reserve(packageIds.size());
+    for (int row = 0; row < packageIds.size(); ++row) {
+        d->rows.insert(packageIds.at(row), row);
+    }
+
+    // The old rows mean nothing anymore
+    d->windowFirst = -1;
+    d->windowLast = -1;
+    d->lastFirst = -1;
+    d->forward = true;
+}
+
+PackageDetails DetailsPrefetcher::details(const QString &packageID) const
+{
+    Q_D(const DetailsPrefetcher);
+    const PackageDetails *details = d->cache.object(packageID);
+    return details ? *details : PackageDetails();
+}
+
+bool DetailsPrefetcher::contains(const QString &packageID) const
+{
+    Q_D(const DetailsPrefetcher);
+    return d->cache.contains(packageID);
+}
+
+int DetailsPrefetcher::interval() const
+{
+    Q_D(const DetailsPrefetcher);
+    return d->timer.interval();
+}
+
+void DetailsPrefetcher::setInterval(int msecs)
+{
+    Q_D(DetailsPrefetcher);
+    d->timer.setInterval(msecs);
+}
+
+int DetailsPrefetcher::batchSize() const
+{
+    Q_D(const DetailsPrefetcher);
+    return d->batchSize;
+}
+
+void DetailsPrefetcher::setBatchSize(int size)
+{
+    Q_D(DetailsPrefetcher);
+    d->batchSize = qMax(1, size);
+}
+
+int DetailsPrefetcher::cacheSize() const
+{
+    Q_D(const DetailsPrefetcher);
+    return int(d->cache.maxCost());
+}
+
+void DetailsPrefetcher::setCacheSize(int size)
+{
+    Q_D(DetailsPrefetcher);
+    d->cache.setMaxCost(qMax(0, size));
+}
+
+int DetailsPrefetcher::prefetchCount() const
+{
+    Q_D(const DetailsPrefetcher);
+    return d->prefetchCount;
+}
+
+void DetailsPrefetcher::setPrefetchCount(int count)
+{
+    Q_D(DetailsPrefetcher);
+    d->prefetchCount = qMax(0, count);
+}
+
+bool DetailsPrefetcher::isBusy() const
+{
+    Q_D(const DetailsPrefetcher);
+    return d->busy;
+}
+
+bool DetailsPrefetcher::request(const QString &packageID)
+{
+    Q_D(DetailsPrefetcher);
+    // Looking it up keeps it in the cache for longer
+    if (d->cache.object(packageID)) {
+        return true;
+    }
+    d->enqueue(packageID);
+    d->updateBusy();
+    return false;
+}
+
+void DetailsPrefetcher::setVisibleRange(int first, int last)
+{
+    Q_D(DetailsPrefetcher);
+    const int count = d->packageIds.size();
+    if (count == 0) {
+        return;
+    }
+    first = qBound(0, first, count - 1);
+    last = qBound(first, last, count - 1);
+
+    // Keep the direction while the view stands still
+    if (d->lastFirst >= 0 && first != d->lastFirst) {
+        d->forward = first > d->lastFirst;
+    }
+    d->lastFirst = first;
+    d->windowFirst = d->forward ? first : qMax(0, first - d->prefetchCount);
+    d->windowLast = d->forward ? qMin(count - 1, last + d->prefetchCount) : last;
+
+    // The visible rows go first, then the ones ahead in scroll order.
+    // What was queued before and is still near keeps its place behind them.
+    const QStringList previous = std::move(d->queue);
+    d->queue.clear();
+    for (const QString &packageID : previous) {
+        d->requested.remove(packageID);
+    }
+    for (int row = first; row <= last; ++row) {
+        d->enqueue(d->packageIds.at(row));
+    }
+    if (d->forward) {
+        for (int row = last + 1; row <= d->windowLast; ++row) {
+            d->enqueue(d->packageIds.at(row));
+        }
+    } else {
+        for (int row = first - 1; row >= d->windowFirst; --row) {
+            d->enqueue(d->packageIds.at(row));
+        }
+    }
+    for (const QString &packageID : previous) {
+        if (d->inWindow(packageID)) {
+            d->enqueue(packageID);
+        }
+    }
+
+    // Batches for rows the view has left are not worth waiting for
+    for (DetailsPrefetcherPrivate::Batch &batch : d->batches) {
+        if (batch.cancelled || !batch.transaction) {
+            continue;
+        }
+        const bool stale = std::none_of(batch.packageIds.cbegin(), batch.packageIds.cend(), [d] (const QString &packageID) {
+            return d->inWindow(packageID);
+        });
+        if (stale) {
+            batch.cancelled = true;
+            batch.transaction->cancel();
+        }
+    }
+
+    d->updateBusy();
+}
+
+void DetailsPrefetcher::clear()
+{
+    Q_D(DetailsPrefetcher);
+    d->timer.stop();
+    d->cache.clear();
+    d->queue.clear();
+    d->requested.clear();
+    for (DetailsPrefetcherPrivate::Batch &batch : d->batches) {
+        if (!batch.cancelled && batch.transaction) {
+            batch.cancelled = true;
+            batch.transaction->cancel();
+        }
+    }
+    d->windowFirst = -1;
+    d->windowLast = -1;
+    d->lastFirst = -1;
+    d->updateBusy();
+}
+
+void DetailsPrefetcherPrivate::enqueue(const QString &packageID)
+{
+    if (requested.contains(packageID) || cache.contains(packageID)) {
+        return;
+    }
+    queue.append(packageID);
+    requested.insert(packageID);
+    if (!timer.isActive()) {
+        timer.start();
+    }
+}
+
+void DetailsPrefetcherPrivate::flush()
+{
+    Q_Q(DetailsPrefetcher);
+    if (queue.isEmpty()) {
+        updateBusy();
+        return;
+    }
+
+    const int size = qMin(batchSize, int(queue.size()));
+    const QStringList packageIDs = queue.mid(0, size);
+    queue.erase(queue.begin(), queue.begin() + size);
+
+    Transaction *transaction = Daemon::getDetails(packageIDs);
+    batches.append({ transaction, packageIDs });
+    q->connect(transaction, &Transaction::packageDetails, q, [this] (const QList<PackageDetails> &details) {
+        Q_Q(DetailsPrefetcher);
+        for (const PackageDetails &value : details) {
+            cache.insert(value.packageId(), new PackageDetails(value));
+        }
+        Q_EMIT q->detailsReady(details);
+    });
+    q->connect(transaction, &Transaction::errorCode, q, [this, transaction] (Transaction::Error error, const QString &details) {
+        Q_Q(DetailsPrefetcher);
+        const Batch *batch = findBatch(transaction);
+        if (error != Transaction::ErrorTransactionCancelled && !(batch && batch->cancelled)) {
+            Q_EMIT q->errorCode(error, details);
+        }
+    });
+    q->connect(transaction, &Transaction::finished, q, [this, transaction] {
+        batchFinished(transaction);
+    });
+
+    // One batch per interval, the rest waits for the next one
+    if (!queue.isEmpty()) {
+        timer.start();
+    }
+}
+
+void DetailsPrefetcherPrivate::batchFinished(Transaction *transaction)
+{
+    const auto it = std::find_if(batches.begin(), batches.end(), [transaction] (const Batch &batch) {
+        return batch.transaction == transaction;
+    });
+    if (it == batches.end()) {
+        return;
+    }
+    const Batch batch = *it;
+    batches.erase(it);
+
+    for (const QString &packageID : batch.packageIds) {
+        requested.remove(packageID);
+    }
+
+    // The view may have come back while the batch was being cancelled
+    if (batch.cancelled) {
+        for (const QString &packageID : batch.packageIds) {
+            if (windowFirst >= 0 && inWindow(packageID)) {
+                enqueue(packageID);
+            }
+        }
+    }
+
+    updateBusy();
+}
+
+DetailsPrefetcherPrivate::Batch *DetailsPrefetcherPrivate::findBatch(Transaction *transaction)
+{
+    for (Batch &batch : batches) {
+        if (batch.transaction == transaction) {
+            return &batch;
+        }
+    }
+    return nullptr;
+}
+
+bool DetailsPrefetcherPrivate::inWindow(const QString &packageID) const
+{
+    if (windowFirst < 0) {
+        return true;
+    }
+
+    // Requested by ID only, not part of the rows
+    const int row = rows.value(packageID, -1);
+    return row < 0 || (row >= windowFirst && row <= windowLast);
+}
+
+void DetailsPrefetcherPrivate::updateBusy()
+{
+    Q_Q(DetailsPrefetcher);
+    const bool isBusy = !queue.isEmpty() || !batches.isEmpty();
+    if (busy != isBusy) {
+        busy = isBusy;
+        Q_EMIT q->busyChanged();
+    }
+}
+
+#include "moc_detailsprefetcher.cpp"
@@ -0,0 +1,148 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_DETAILS_PREFETCHER_H
+#define PACKAGEKIT_DETAILS_PREFETCHER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+#include <packagekitqt_global.h>
+
+#include "packagedetails.h"
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class DetailsPrefetcher detailsprefetcher.h DetailsPrefetcher
+ *
+ * \brief Fetches package details for long lists, a screen at a time
+ *
+ * Views showing thousands of packages usually need the details of the few
+ * rows visible. Instead of one Daemon::getDetails() per row the prefetcher
+ * collects the requested package IDs and asks for all of them with a single
+ * transaction every interval(), by default once per frame. Results are kept
+ * in a cache of the cacheSize() most recently used packages, so scrolling
+ * back does not query the daemon again.
+ *
+ * When the view reports the rows it shows with setVisibleRange(), the
+ * prefetcher also asks for the prefetchCount() rows following in the scroll
+ * direction. Requests that fell out of that window before being sent are
+ * dropped and running batches holding none of its packages are cancelled.
+ */
+class DetailsPrefetcherPrivate;
+class PACKAGEKITQT_LIBRARY DetailsPrefetcher : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int interval READ interval WRITE setInterval)
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize)
+    Q_PROPERTY(int cacheSize READ cacheSize WRITE setCacheSize)
+    Q_PROPERTY(int prefetchCount READ prefetchCount WRITE setPrefetchCount)
+    Q_PROPERTY(bool busy READ isBusy NOTIFY busyChanged)
+public:
+    explicit DetailsPrefetcher(QObject *parent = nullptr);
+    ~DetailsPrefetcher() override;
+
+    /**
+     * The package IDs of the rows of the view, in order
+     * \sa setVisibleRange()
+     */
+    QStringList packageIds() const;
+    void setPackageIds(const QStringList &packageIds);
+
+    /**
+     * Returns the cached details of \p packageID, or invalid
+     * details if they were not fetched yet
+     */
+    PackageDetails details(const QString &packageID) const;
+
+    bool contains(const QString &packageID) const;
+
+    /**
+     * Milliseconds requests are collected before a batch is sent, defaults to 16
+     */
+    int interval() const;
+    void setInterval(int msecs);
+
+    /**
+     * The maximum number of packages asked for by one transaction, defaults to 200
+     */
+    int batchSize() const;
+    void setBatchSize(int size);
+
+    /**
+     * The number of packages whose details are kept, defaults to 5000
+     */
+    int cacheSize() const;
+    void setCacheSize(int size);
+
+    /**
+     * The number of rows past the visible ones fetched ahead, defaults to 40
+     */
+    int prefetchCount() const;
+    void setPrefetchCount(int count);
+
+    /**
+     * Returns true while requests are queued or batches are running
+     */
+    bool isBusy() const;
+
+public Q_SLOTS:
+    /**
+     * Asks for the details of \p packageID, which are sent by detailsReady()
+     * with the next batch. Returns true, without any request, if they are
+     * cached already.
+     */
+    bool request(const QString &packageID);
+
+    /**
+     * Tells which rows of packageIds(), \p first to \p last included, are
+     * visible. Their details are requested, as well as the details of the
+     * prefetchCount() rows after them in the direction the view scrolled.
+     */
+    void setVisibleRange(int first, int last);
+
+    /**
+     * Drops the cache, queued requests and cancels running batches
+     */
+    void clear();
+
+Q_SIGNALS:
+    /**
+     * Emitted with the details received by a batch
+     */
+    void detailsReady(const QList<PackageKit::PackageDetails> &details);
+
+    /**
+     * Emitted when a batch failed, other than being cancelled
+     */
+    void errorCode(PackageKit::Transaction::Error error, const QString &details);
+
+    void busyChanged();
+
+private:
+    Q_DECLARE_PRIVATE(DetailsPrefetcher)
+    DetailsPrefetcherPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,243 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "filelist.h"
+
+#include <QLoggingCategory>
+
+#include <algorithm>
+
+Q_DECLARE_LOGGING_CATEGORY(PACKAGEKITQT_TRANSACTION)
+
+namespace PackageKit {
+
+// Paths stored in full, so file() decodes at most that many of them
+constexpr int BlockSize = 16;
+
+class FileListData : public QSharedData
+{
+public:
+    // Prefix length and suffix length as varints, then the suffix
+    QByteArray data;
+    // Offset in data of every BlockSize-th path
+    QList<quint32> blocks;
+
+    QStringList packageIds;
+    // Index of the first file of each package
+    QList<int> packageFirstFile;
+    int fileCount = 0;
+
+    // The path appended last, to share its prefix
+    QByteArray last;
+
+    void append(const QByteArray &path);
+    QByteArray decode(int index) const;
+};
+
+}
+
+using namespace PackageKit;
+
+namespace {
+
+void writeVarint(QByteArray &data, quint32 value)
+{
+    while (value >= 0x80) {
+        data.append(char((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    data.append(char(value));
+}
+
+quint32 readVarint(const char *&it)
+{
+    quint32 value = 0;
+    int shift = 0;
+    uchar byte;
+    do {
+        byte = uchar(*it++);
+        value |= quint32(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+// Reads the entry at it and makes path the path it stands for
+void readEntry(const char *&it, QByteArray &path)
+{
+    const quint32 prefix = readVarint(it);
+    const quint32 suffix = readVarint(it);
+    path.truncate(prefix);
+    path.append(it, suffix);
+    it += suffix;
+}
+
+}
+
+void FileListData::append(const QByteArray &path)
+{
+    qsizetype prefix = 0;
+    if (fileCount % BlockSize == 0) {
+        blocks.append(quint32(data.size()));
+    } else {
+        const qsizetype max = std::min(last.size(), path.size());
+        while (prefix < max && last[prefix] == path[prefix]) {
+            ++prefix;
+        }
+    }
+
+    writeVarint(data, quint32(prefix));
+    writeVarint(data, quint32(path.size() - prefix));
+    data.append(path.constData() + prefix, path.size() - prefix);
+    last = path;
+    ++fileCount;
+}
+
+QByteArray FileListData::decode(int index) const
+{
+    const char *it = data.constData() + blocks[index / BlockSize];
+    QByteArray path;
+    for (int i = index - index % BlockSize; i <= index; ++i) {
+        readEntry(it, path);
+    }
+    return path;
+}
+
+FileList::FileList() = default;
+
+FileList::FileList(const FileList &other) = default;
+
+FileList::~FileList() = default;
+
+FileList &FileList::operator=(const FileList &other) = default;
+
+bool FileList::isEmpty() const
+{
+    return !d || d->packageIds.isEmpty();
+}
+
+void FileList::clear()
+{
+    d.reset();
+}
+
+void FileList::append(const QString &packageID, const QStringList &files)
+{
+    addPackage(packageID);
+    for (const QString &file : files) {
+        addFile(file);
+    }
+}
+
+void FileList::addPackage(const QString &packageID)
+{
+    if (d) {
+        d.detach();
+    } else {
+        d = new FileListData;
+    }
+    d->packageIds.append(packageID);
+    d->packageFirstFile.append(d->fileCount);
+}
+
+void FileList::addFile(QStringView file)
+{
+    if (isEmpty()) {
+        qCWarning(PACKAGEKITQT_TRANSACTION) << "FileList::addFile: addPackage() must be called first";
+        return;
+    }
+    d.detach();
+    d->append(file.toUtf8());
+}
+
+int FileList::packageCount() const
+{
+    return d ? d->packageIds.size() : 0;
+}
+
+QString FileList::packageID(int package) const
+{
+    return d ? d->packageIds.value(package) : QString();
+}
+
+int FileList::firstFile(int package) const
+{
+    return d ? d->packageFirstFile.value(package, -1) : -1;
+}
+
+int FileList::fileCount(int package) const
+{
+    if (!d || package < 0 || package >= d->packageIds.size()) {
+        return 0;
+    }
+    const int next = package + 1 < d->packageFirstFile.size() ? d->packageFirstFile[package + 1] : d->fileCount;
+    return next - d->packageFirstFile[package];
+}
+
+QStringList FileList::files(int package) const
+{
+    const int count = fileCount(package);
+    if (count == 0) {
+        return QStringList();
+    }
+
+    // Decode from the block start once, then walk the package sequentially
+    const int first = d->packageFirstFile[package];
+    const char *it = d->data.constData() + d->blocks[first / BlockSize];
+    QByteArray path;
+    for (int i = first - first % BlockSize; i < first; ++i) {
+        readEntry(it, path);
+    }
+
+    QStringList files;
+    files.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        readEntry(it, path);
+        files.append(QString::fromUtf8(path));
+    }
+    return files;
+}
+
+int FileList::fileCount() const
+{
+    return d ? d->fileCount : 0;
+}
+
+QString FileList::file(int index) const
+{
+    if (!d || index < 0 || index >= d->fileCount) {
+        return QString();
+    }
+    return QString::fromUtf8(d->decode(index));
+}
+
+int FileList::packageOf(int index) const
+{
+    if (!d || index < 0 || index >= d->fileCount) {
+        return -1;
+    }
+    const auto it = std::upper_bound(d->packageFirstFile.cbegin(), d->packageFirstFile.cend(), index);
+    return int(it - d->packageFirstFile.cbegin()) - 1;
+}
+
+qsizetype FileList::encodedSize() const
+{
+    return d ? d->data.size() + d->blocks.size() * qsizetype(sizeof(quint32)) : 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_FILE_LIST_H
+#define PACKAGEKIT_FILE_LIST_H
+
+#include <QtCore/QExplicitlySharedDataPointer>
+#include <QtCore/QMetaType>
+#include <QtCore/QStringList>
+#include <QtCore/QStringView>
+
+#include <packagekitqt_global.h>
+
+namespace PackageKit {
+
+/**
+ * \class FileList filelist.h FileList
+ *
+ * \brief The files of a list of packages, stored compactly
+ *
+ * The paths sent by getFiles() share long prefixes, like /usr/share/ or
+ * /usr/lib/, and holding each of them as a QString costs an allocation
+ * and two bytes per character. FileList keeps them in one buffer
+ * instead: every path is stored in UTF-8 as the length of the prefix it
+ * shares with the previous one and the remaining bytes. A path is
+ * stored in full every 16 files, so file() only decodes a few of them.
+ *
+ * The files keep the order the daemon sent them in, grouped by package,
+ * and packageOf() maps a file back to the package owning it.
+ *
+ * This class is implicitly shared.
+ *
+ * \sa Transaction::fileList(), Daemon::getFiles()
+ */
+class FileListData;
+class PACKAGEKITQT_LIBRARY FileList
+{
+public:
+    FileList();
+    FileList(const FileList &other);
+    ~FileList();
+
+    FileList &operator=(const FileList &other);
+
+    bool isEmpty() const;
+
+    /**
+     * Removes all the packages and files
+     */
+    void clear();
+
+    /**
+     * Appends \p packageID and its \p files
+     */
+    void append(const QString &packageID, const QStringList &files);
+
+    /**
+     * Appends \p packageID without files, addFile() then adds them
+     */
+    void addPackage(const QString &packageID);
+
+    /**
+     * Appends \p file to the package added last
+     */
+    void addFile(QStringView file);
+
+    /**
+     * Returns the number of packages
+     */
+    int packageCount() const;
+
+    /**
+     * Returns the id of the package at \p package
+     */
+    QString packageID(int package) const;
+
+    /**
+     * Returns the index of the first file of the package at \p package
+     */
+    int firstFile(int package) const;
+
+    /**
+     * Returns the number of files of the package at \p package
+     */
+    int fileCount(int package) const;
+
+    /**
+     * Returns the files of the package at \p package
+     */
+    QStringList files(int package) const;
+
+    /**
+     * Returns the number of files of all packages
+     */
+    int fileCount() const;
+
+    /**
+     * Returns the file at \p index, counted over all packages
+     */
+    QString file(int index) const;
+
+    /**
+     * Returns the index of the package owning the file at \p index
+     */
+    int packageOf(int index) const;
+
+    /**
+     * Returns the number of bytes taken by the encoded paths
+     */
+    qsizetype encodedSize() const;
+
+private:
+    QExplicitlySharedDataPointer<FileListData> d;
+};
+
+} // End namespace PackageKit
+
+Q_DECLARE_METATYPE(PackageKit::FileList)
+
+#endif
@@ -0,0 +1,773 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "fileownerindex.h"
+
+#include "daemon.h"
+#include "filelist.h"
+#include "transactionhistoryprivate.h"
+#include "transactionrecord.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QLoggingCategory>
+#include <QSaveFile>
+#include <QSet>
+#include <QStandardPaths>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+Q_LOGGING_CATEGORY(PACKAGEKITQT_FILE_OWNER, "packagekitqt.fileowner")
+
+namespace PackageKit {
+
+class FileOwnerIndexPrivate
+{
+    Q_DECLARE_PUBLIC(FileOwnerIndex)
+public:
+    FileOwnerIndexPrivate(FileOwnerIndex *parent) : q_ptr(parent) {}
+
+    // An edge of the trie and the node it leads to, the children of a
+    // node are contiguous and sorted by the first byte of their label
+    struct Node {
+        quint32 label = 0;
+        quint32 labelLength = 0;
+        quint32 firstChild = 0;
+        quint32 childCount = 0;
+        quint32 firstOwner = 0;
+        quint32 ownerCount = 0;
+    };
+
+    struct Entry {
+        QByteArray path;
+        quint32 package;
+    };
+
+    static bool changesPackages(const TransactionRecord &record);
+
+    const Node *find(const QString &file) const;
+    void build(const QStringList &newPackageIds, const QList<FileList> &lists);
+    void buildNode(quint32 node, const std::vector<Entry> &entries, size_t lo, size_t hi, qsizetype depth);
+
+    bool isConsistent() const;
+    void load();
+    bool save() const;
+    QString stampFileName() const;
+    void loadStamp();
+    bool saveStamp() const;
+    void start();
+    void fetchStamp();
+    void fetchFiles(const QString &newStamp);
+    void finishBuild(bool success);
+    void verify();
+    void verified(const QList<TransactionRecord> &records, Transaction::Exit status);
+    void transactionListChanged(const QStringList &tids);
+    void watch(Transaction *transaction);
+    void setBuilding(bool value);
+
+    FileOwnerIndex *q_ptr;
+    QString fileName;
+
+    QStringList packageIds;
+    QByteArray labels;
+    QList<Node> nodes;
+    QList<quint32> owners;
+    int fileCount = 0;
+    // The newest history entry when the index was built, stored with it
+    QString builtStamp;
+    // The newest history entry checked, stored in stampFileName()
+    QString stamp;
+
+    bool loaded = false;
+    bool valid = false;
+    bool building = false;
+    bool rebuildQueued = false;
+    bool verifying = false;
+    bool verifyQueued = false;
+    bool autoRebuild = true;
+
+    // Transactions seen running, and the ones started here
+    QSet<QString> runningTids;
+    QSet<QString> ownTids;
+};
+
+}
+
+using namespace PackageKit;
+
+namespace {
+
+// "PKFO", followed by the format version
+constexpr quint32 IndexMagic = 0x504b464f;
+constexpr quint32 IndexVersion = 1;
+
+// History entries checked for changes, an older stamp means too much happened
+constexpr uint VerifyWindow = 20;
+
+}
+
+FileOwnerIndex::FileOwnerIndex(QObject *parent)
+    : FileOwnerIndex(defaultFileName(), parent)
+{
+}
+
+FileOwnerIndex::FileOwnerIndex(const QString &fileName, QObject *parent)
+    : QObject(parent)
+    , d_ptr(new FileOwnerIndexPrivate(this))
+{
+    Q_D(FileOwnerIndex);
+    d->fileName = fileName;
+    d->load();
+
+    connect(Daemon::global(), &Daemon::updatesChanged, this, [d] {
+        d->verify();
+    });
+    connect(Daemon::global(), &Daemon::transactionListChanged, this, [d] (const QStringList &tids) {
+        d->transactionListChanged(tids);
+    });
+
+    // Leaves the time to call setAutoRebuild()
+    QMetaObject::invokeMethod(this, [d] {
+        d->start();
+    }, Qt::QueuedConnection);
+}
+
+FileOwnerIndex::~FileOwnerIndex()
+{
+    delete d_ptr;
+}
+
+QString FileOwnerIndex::defaultFileName()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            + QLatin1String("/packagekitqt-file-owners");
+}
+
+QString FileOwnerIndex::fileName() const
+{
+    Q_D(const FileOwnerIndex);
+    return d->fileName;
+}
+
+QString FileOwnerIndex::owner(const QString &file) const
+{
+    Q_D(const FileOwnerIndex);
+    const FileOwnerIndexPrivate::Node *node = d->find(file);
+    return node ? d->packageIds.at(d->owners.at(node->firstOwner)) : QString();
+}
+
+QStringList FileOwnerIndex::owners(const QString &file) const
+{
+    Q_D(const FileOwnerIndex);
+    QStringList ret;
+    if (const FileOwnerIndexPrivate::Node *node = d->find(file)) {
+        ret.reserve(node->ownerCount);
+        for (quint32 i = 0; i < node->ownerCount; ++i) {
+            ret.append(d->packageIds.at(d->owners.at(node->firstOwner + i)));
+        }
+    }
+    return ret;
+}
+
+bool FileOwnerIndex::contains(const QString &file) const
+{
+    Q_D(const FileOwnerIndex);
+    return d->find(file);
+}
+
+int FileOwnerIndex::fileCount() const
+{
+    Q_D(const FileOwnerIndex);
+    return d->fileCount;
+}
+
+int FileOwnerIndex::packageCount() const
+{
+    Q_D(const FileOwnerIndex);
+    return d->packageIds.size();
+}
+
+bool FileOwnerIndex::isValid() const
+{
+    Q_D(const FileOwnerIndex);
+    return d->valid;
+}
+
+bool FileOwnerIndex::isBuilding() const
+{
+    Q_D(const FileOwnerIndex);
+    return d->building;
+}
+
+bool FileOwnerIndex::autoRebuild() const
+{
+    Q_D(const FileOwnerIndex);
+    return d->autoRebuild;
+}
+
+void FileOwnerIndex::setAutoRebuild(bool enable)
+{
+    Q_D(FileOwnerIndex);
+    d->autoRebuild = enable;
+}
+
+void FileOwnerIndex::rebuild()
+{
+    Q_D(FileOwnerIndex);
+    if (d->building) {
+        d->rebuildQueued = true;
+        return;
+    }
+
+    d->setBuilding(true);
+    d->fetchStamp();
+}
+
+void FileOwnerIndex::invalidate()
+{
+    Q_D(FileOwnerIndex);
+    if (d->valid) {
+        d->valid = false;
+        Q_EMIT validChanged();
+        Q_EMIT invalidated();
+    }
+
+    if (d->autoRebuild) {
+        rebuild();
+    }
+}
+
+bool FileOwnerIndexPrivate::changesPackages(const TransactionRecord &record)
+{
+    if (!record.succeeded()) {
+        return false;
+    }
+
+    switch (record.role()) {
+    case Transaction::RoleInstallFiles:
+    case Transaction::RoleInstallPackages:
+    case Transaction::RoleRemovePackages:
+    case Transaction::RoleRepairSystem:
+    case Transaction::RoleRepoRemove:
+    case Transaction::RoleUpdatePackages:
+    case Transaction::RoleUpgradeSystem:
+        return true;
+    default:
+        return false;
+    }
+}
+
+const FileOwnerIndexPrivate::Node *FileOwnerIndexPrivate::find(const QString &file) const
+{
+    if (nodes.isEmpty()) {
+        return nullptr;
+    }
+
+    const QByteArray path = file.toUtf8();
+    const char *labelData = labels.constData();
+    qsizetype pos = 0;
+    const Node *node = &nodes.at(0);
+    while (pos < path.size()) {
+        // Children start with distinct bytes, so at most one can match
+        const auto first = nodes.cbegin() + node->firstChild;
+        const auto last = first + node->childCount;
+        const uchar byte = uchar(path.at(pos));
+        const auto child = std::lower_bound(first, last, byte, [labelData] (const Node &candidate, uchar value) {
+            return uchar(labelData[candidate.label]) < value;
+        });
+        if (child == last
+                || child->labelLength > quint32(path.size() - pos)
+                || std::memcmp(labelData + child->label, path.constData() + pos, child->labelLength) != 0) {
+            return nullptr;
+        }
+        pos += child->labelLength;
+        node = &*child;
+    }
+    return node->ownerCount ? node : nullptr;
+}
+
+void FileOwnerIndexPrivate::build(const QStringList &newPackageIds, const QList<FileList> &lists)
+{
+    std::vector<Entry> entries;
+    QHash<QString, quint32> packageIndexes;
+    packageIds.clear();
+    for (const FileList &list : lists) {
+        for (int package = 0; package < list.packageCount(); ++package) {
+            const QString packageID = list.packageID(package);
+            quint32 index = quint32(packageIds.size());
+            const auto it = packageIndexes.constFind(packageID);
+            if (it == packageIndexes.constEnd()) {
+                packageIndexes.insert(packageID, index);
+                packageIds.append(packageID);
+            } else {
+                index = *it;
+            }
+            const QStringList files = list.files(package);
+            for (const QString &file : files) {
+                entries.push_back({ file.toUtf8(), index });
+            }
+        }
+    }
+    // Installed packages without files still count as indexed
+    for (const QString &packageID : newPackageIds) {
+        if (!packageIndexes.contains(packageID)) {
+            packageIndexes.insert(packageID, quint32(packageIds.size()));
+            packageIds.append(packageID);
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [] (const Entry &a, const Entry &b) {
+        const int cmp = a.path.compare(b.path);
+        return cmp < 0 || (cmp == 0 && a.package < b.package);
+    });
+
+    labels.clear();
+    nodes.clear();
+    owners.clear();
+    fileCount = 0;
+    nodes.append(Node());
+    buildNode(0, entries, 0, entries.size(), 0);
+    labels.squeeze();
+    nodes.squeeze();
+    owners.squeeze();
+}
+
+void FileOwnerIndexPrivate::buildNode(quint32 node, const std::vector<Entry> &entries, size_t lo, size_t hi, qsizetype depth)
+{
+    // All entries in [lo, hi) share their first depth bytes, the ones
+    // ending there come first and are owned by this node
+    size_t i = lo;
+    if (i < hi && entries[i].path.size() == depth) {
+        nodes[node].firstOwner = quint32(owners.size());
+        for (; i < hi && entries[i].path.size() == depth; ++i) {
+            if (owners.size() == qsizetype(nodes[node].firstOwner) || owners.constLast() != entries[i].package) {
+                owners.append(entries[i].package);
+            }
+        }
+        nodes[node].ownerCount = quint32(owners.size()) - nodes[node].firstOwner;
+        ++fileCount;
+    }
+
+    // One child per distinct next byte
+    QList<std::pair<size_t, size_t>> groups;
+    while (i < hi) {
+        const char byte = entries[i].path.at(depth);
+        size_t j = i + 1;
+        while (j < hi && entries[j].path.at(depth) == byte) {
+            ++j;
+        }
+        groups.append({ i, j });
+        i = j;
+    }
+    if (groups.isEmpty()) {
+        return;
+    }
+
+    const quint32 firstChild = quint32(nodes.size());
+    nodes[node].firstChild = firstChild;
+    nodes[node].childCount = quint32(groups.size());
+    nodes.resize(nodes.size() + groups.size());
+
+    for (qsizetype g = 0; g < groups.size(); ++g) {
+        const auto [from, to] = groups.at(g);
+
+        // Sorted, so the first and last entries share the least
+        const QByteArray &first = entries[from].path;
+        const QByteArray &last = entries[to - 1].path;
+        const qsizetype max = std::min(first.size(), last.size());
+        qsizetype end = depth + 1;
+        while (end < max && first.at(end) == last.at(end)) {
+            ++end;
+        }
+
+        Node &child = nodes[firstChild + g];
+        child.label = quint32(labels.size());
+        child.labelLength = quint32(end - depth);
+        labels.append(first.constData() + depth, end - depth);
+        buildNode(firstChild + quint32(g), entries, from, to, end);
+    }
+}
+
+void FileOwnerIndexPrivate::load()
+{
+    QFile file(fileName);
+    if (!file.exists()) {
+        return;
+    }
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(PACKAGEKITQT_FILE_OWNER) << "Failed to open" << fileName << file.errorString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != IndexMagic || version != IndexVersion) {
+        qCWarning(PACKAGEKITQT_FILE_OWNER) << "Ignoring unknown index file" << fileName;
+        return;
+    }
+
+    quint32 nodeCount = 0;
+    qint32 files = 0;
+    stream >> builtStamp >> packageIds >> labels >> owners >> files >> nodeCount;
+
+    // Six numbers per node, don't trust a damaged count
+    if (stream.status() == QDataStream::Ok && qint64(nodeCount) <= (file.size() - file.pos()) / qint64(6 * sizeof(quint32))) {
+        nodes.resize(nodeCount);
+    } else {
+        stream.setStatus(QDataStream::ReadCorruptData);
+    }
+    for (Node &node : nodes) {
+        stream >> node.label >> node.labelLength >> node.firstChild >> node.childCount >> node.firstOwner >> node.ownerCount;
+    }
+    fileCount = files;
+
+    if (stream.status() != QDataStream::Ok || !isConsistent()) {
+        qCWarning(PACKAGEKITQT_FILE_OWNER) << "Ignoring damaged index file" << fileName;
+        builtStamp.clear();
+        packageIds.clear();
+        labels.clear();
+        owners.clear();
+        nodes.clear();
+        fileCount = 0;
+        return;
+    }
+
+    stamp = builtStamp;
+    loadStamp();
+    loaded = true;
+    valid = true;
+}
+
+bool FileOwnerIndexPrivate::isConsistent() const
+{
+    // find() and owners() index with these without further checks
+    if (nodes.isEmpty() || fileCount < 0) {
+        return false;
+    }
+    for (qsizetype i = 0; i < nodes.size(); ++i) {
+        const Node &node = nodes.at(i);
+        if (quint64(node.label) + node.labelLength > quint64(labels.size())
+                || quint64(node.firstOwner) + node.ownerCount > quint64(owners.size())
+                || quint64(node.firstChild) + node.childCount > quint64(nodes.size())) {
+            return false;
+        }
+        // Every edge but the root's consumes a byte, children come after
+        // their parent, so lookups always end
+        if ((i > 0 && node.labelLength == 0) || (node.childCount > 0 && node.firstChild <= quint64(i))) {
+            return false;
+        }
+    }
+    for (quint32 owner : owners) {
+        if (owner >= quint32(packageIds.size())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FileOwnerIndexPrivate::save() const
+{
+    QDir().mkpath(QFileInfo(fileName).absolutePath());
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(PACKAGEKITQT_FILE_OWNER) << "Failed to open" << fileName << file.errorString();
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << IndexMagic << IndexVersion;
+    stream << builtStamp << packageIds << labels << owners << qint32(fileCount) << quint32(nodes.size());
+    for (const Node &node : nodes) {
+        stream << node.label << node.labelLength << node.firstChild << node.childCount << node.firstOwner << node.ownerCount;
+    }
+    if (stream.status() != QDataStream::Ok || !file.commit()) {
+        return false;
+    }
+
+    // Belongs to the previous build
+    QFile::remove(stampFileName());
+    return true;
+}
+
+QString FileOwnerIndexPrivate::stampFileName() const
+{
+    return fileName + QLatin1String(".stamp");
+}
+
+void FileOwnerIndexPrivate::loadStamp()
+{
+    QFile file(stampFileName());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString built;
+    QString checked;
+    stream >> magic >> version >> built >> checked;
+
+    // Only valid for the build it was written for
+    if (stream.status() == QDataStream::Ok && magic == IndexMagic && version == IndexVersion && built == builtStamp) {
+        stamp = checked;
+    }
+}
+
+bool FileOwnerIndexPrivate::saveStamp() const
+{
+    // Small, so the index doesn't have to be written again
+    QSaveFile file(stampFileName());
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(PACKAGEKITQT_FILE_OWNER) << "Failed to open" << stampFileName() << file.errorString();
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << IndexMagic << IndexVersion << builtStamp << stamp;
+    return stream.status() == QDataStream::Ok && file.commit();
+}
+
+void FileOwnerIndexPrivate::start()
+{
+    Q_Q(FileOwnerIndex);
+    if (loaded) {
+        verify();
+    } else if (autoRebuild) {
+        q->rebuild();
+    }
+}
+
+void FileOwnerIndexPrivate::watch(Transaction *transaction)
+{
+    Q_Q(FileOwnerIndex);
+
+    // Their end must not look like activity of another client. The role
+    // is known long before the transaction leaves the daemon's list.
+    q->connect(transaction, &Transaction::roleChanged, q, [this, transaction] {
+        ownTids.insert(transaction->tid().path());
+    });
+    // Ended before a list update showed it, transactionListChanged() won't remove it
+    q->connect(transaction, &Transaction::finished, q, [this, transaction] {
+        const QString tid = transaction->tid().path();
+        if (runningTids.contains(tid)) {
+            ownTids.insert(tid);
+        } else {
+            ownTids.remove(tid);
+        }
+    });
+    q->connect(transaction, &Transaction::errorCode, q, &FileOwnerIndex::errorCode);
+}
+
+void FileOwnerIndexPrivate::fetchStamp()
+{
+    Q_Q(FileOwnerIndex);
+
+    // Taken first, so changes made while fetching the files are seen later
+    auto newStamp = std::make_shared<QString>();
+    Transaction *transaction = Daemon::getOldTransactions(1);
+    watch(transaction);
+    q->connect(transaction, &Transaction::transactionRecords,
+               q, [newStamp] (const QList<TransactionRecord> &records) {
+        if (newStamp->isEmpty() && !records.isEmpty()) {
+            *newStamp = historyKey(records.constFirst());
+        }
+    });
+    q->connect(transaction, &Transaction::finished, q, [this, newStamp] (Transaction::Exit status) {
+        if (status != Transaction::ExitSuccess) {
+            finishBuild(false);
+            return;
+        }
+        fetchFiles(*newStamp);
+    });
+}
+
+void FileOwnerIndexPrivate::fetchFiles(const QString &newStamp)
+{
+    Q_Q(FileOwnerIndex);
+
+    auto installed = std::make_shared<QStringList>();
+    Transaction *transaction = Daemon::getPackages(Transaction::FilterInstalled);
+    watch(transaction);
+    q->connect(transaction, &Transaction::package, q, [installed] (Transaction::Info, const QString &packageID) {
+        installed->append(packageID);
+    });
+    q->connect(transaction, &Transaction::finished, q, [this, q, installed, newStamp] (Transaction::Exit status) {
+        if (status != Transaction::ExitSuccess) {
+            finishBuild(false);
+            return;
+        }
+        if (installed->isEmpty()) {
+            build(QStringList(), QList<FileList>());
+            builtStamp = newStamp;
+            stamp = newStamp;
+            finishBuild(true);
+            return;
+        }
+
+        auto lists = std::make_shared<QList<FileList>>();
+        Transaction *files = Daemon::getFiles(*installed);
+        watch(files);
+        q->connect(files, &Transaction::fileList, q, [lists] (const FileList &batch) {
+            lists->append(batch);
+        });
+        q->connect(files, &Transaction::finished, q, [this, installed, lists, newStamp] (Transaction::Exit status) {
+            if (status != Transaction::ExitSuccess) {
+                finishBuild(false);
+                return;
+            }
+            build(*installed, *lists);
+            builtStamp = newStamp;
+            stamp = newStamp;
+            finishBuild(true);
+        });
+    });
+}
+
+void FileOwnerIndexPrivate::finishBuild(bool success)
+{
+    Q_Q(FileOwnerIndex);
+
+    if (success) {
+        if (!save()) {
+            qCWarning(PACKAGEKITQT_FILE_OWNER) << "Failed to store the index in" << fileName;
+        }
+        loaded = true;
+    }
+    setBuilding(false);
+
+    if (success) {
+        const bool wasValid = std::exchange(valid, true);
+        if (!wasValid) {
+            Q_EMIT q->validChanged();
+        }
+        Q_EMIT q->built();
+    }
+
+    if (rebuildQueued) {
+        rebuildQueued = false;
+        q->rebuild();
+    } else if (verifyQueued) {
+        verifyQueued = false;
+        verify();
+    }
+}
+
+void FileOwnerIndexPrivate::verify()
+{
+    Q_Q(FileOwnerIndex);
+    if (!valid) {
+        return;
+    }
+    if (building || verifying) {
+        verifyQueued = true;
+        return;
+    }
+
+    verifying = true;
+    auto records = std::make_shared<QList<TransactionRecord>>();
+    Transaction *transaction = Daemon::getOldTransactions(VerifyWindow);
+    watch(transaction);
+    q->connect(transaction, &Transaction::transactionRecords,
+               q, [records] (const QList<TransactionRecord> &batch) {
+        records->append(batch);
+    });
+    q->connect(transaction, &Transaction::finished, q, [this, records] (Transaction::Exit status) {
+        verified(*records, status);
+    });
+}
+
+void FileOwnerIndexPrivate::verified(const QList<TransactionRecord> &records, Transaction::Exit status)
+{
+    Q_Q(FileOwnerIndex);
+    verifying = false;
+
+    if (status == Transaction::ExitSuccess && valid) {
+        // The daemon sends the newest entries first
+        bool reachedStamp = stamp.isEmpty() && uint(records.size()) < VerifyWindow;
+        bool changed = false;
+        for (const TransactionRecord &record : records) {
+            if (historyKey(record) == stamp) {
+                reachedStamp = true;
+                break;
+            }
+            changed = changed || changesPackages(record);
+        }
+
+        if (changed || !reachedStamp) {
+            q->invalidate();
+        } else if (!records.isEmpty() && historyKey(records.constFirst()) != stamp) {
+            // Nothing relevant happened, only look at what is newer next time,
+            // also after a restart
+            stamp = historyKey(records.constFirst());
+            if (!saveStamp()) {
+                qCWarning(PACKAGEKITQT_FILE_OWNER) << "Failed to store the checked history entry in" << stampFileName();
+            }
+        }
+    }
+
+    if (verifyQueued) {
+        verifyQueued = false;
+        verify();
+    }
+}
+
+void FileOwnerIndexPrivate::transactionListChanged(const QStringList &tids)
+{
+    const QSet<QString> running(tids.cbegin(), tids.cend());
+    bool foreignEnded = false;
+    for (const QString &tid : std::as_const(runningTids)) {
+        if (!running.contains(tid) && !ownTids.remove(tid)) {
+            foreignEnded = true;
+        }
+    }
+    runningTids = running;
+
+    if (foreignEnded) {
+        verify();
+    }
+}
+
+void FileOwnerIndexPrivate::setBuilding(bool value)
+{
+    Q_Q(FileOwnerIndex);
+    if (building != value) {
+        building = value;
+        Q_EMIT q->buildingChanged();
+    }
+}
+
+#include "moc_fileownerindex.cpp"
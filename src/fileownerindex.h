@@ -0,0 +1,154 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_FILE_OWNER_INDEX_H
+#define PACKAGEKIT_FILE_OWNER_INDEX_H
+
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class FileOwnerIndex fileownerindex.h FileOwnerIndex
+ *
+ * \brief Tells which installed packages own a file, without asking the daemon
+ *
+ * Daemon::searchFiles() costs a transaction per question. This class
+ * instead fetches the files of all installed packages once and keeps
+ * them in a trie over the bytes of the paths, so owner() walks the path
+ * once and is independent of the number of files known. The index is
+ * stored in a file and available right after construction.
+ *
+ * The index remembers the newest entry of the daemon's transaction
+ * history when it was built. Each time Daemon::updatesChanged() is
+ * emitted or a transaction of another client ends, the entries added
+ * since are checked, and a successful transaction installing, updating
+ * or removing packages invalidates the index. It is then rebuilt, unless
+ * autoRebuild() is disabled. The same check is done on construction.
+ */
+class FileOwnerIndexPrivate;
+class PACKAGEKITQT_LIBRARY FileOwnerIndex : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool valid READ isValid NOTIFY validChanged)
+    Q_PROPERTY(bool building READ isBuilding NOTIFY buildingChanged)
+    Q_PROPERTY(bool autoRebuild READ autoRebuild WRITE setAutoRebuild)
+public:
+    /**
+     * Opens the index stored at defaultFileName()
+     */
+    explicit FileOwnerIndex(QObject *parent = nullptr);
+
+    /**
+     * Opens the index stored at \p fileName, the file is written on each build,
+     * the newest history entry checked since is kept next to it in
+     * \p fileName with ".stamp" appended
+     */
+    explicit FileOwnerIndex(const QString &fileName, QObject *parent = nullptr);
+    ~FileOwnerIndex() override;
+
+    /**
+     * Returns the default location of the index file, inside the
+     * application's cache directory
+     */
+    static QString defaultFileName();
+
+    QString fileName() const;
+
+    /**
+     * Returns the package ID of the first package owning \p file, or
+     * an empty string when no installed package has it
+     */
+    QString owner(const QString &file) const;
+
+    /**
+     * Returns the package IDs of all packages owning \p file, directories
+     * are often shared
+     */
+    QStringList owners(const QString &file) const;
+
+    bool contains(const QString &file) const;
+
+    /**
+     * Returns the number of distinct paths in the index
+     */
+    int fileCount() const;
+
+    /**
+     * Returns the number of packages in the index
+     */
+    int packageCount() const;
+
+    /**
+     * Returns true when the index was built and no change of the installed
+     * packages was seen since. An invalid index still answers with the
+     * files it had.
+     */
+    bool isValid() const;
+
+    bool isBuilding() const;
+
+    /**
+     * Whether the index is built again when it is missing or invalid, defaults to true
+     */
+    bool autoRebuild() const;
+    void setAutoRebuild(bool enable);
+
+public Q_SLOTS:
+    /**
+     * Fetches the files of the installed packages and replaces the index
+     */
+    void rebuild();
+
+    /**
+     * Marks the index as outdated
+     */
+    void invalidate();
+
+Q_SIGNALS:
+    /**
+     * Emitted when a build finished and the index is valid again
+     */
+    void built();
+
+    /**
+     * Emitted when a change of the installed packages was seen
+     */
+    void invalidated();
+
+    void errorCode(PackageKit::Transaction::Error error, const QString &details);
+
+    void validChanged();
+
+    void buildingChanged();
+
+private:
+    Q_DECLARE_PRIVATE(FileOwnerIndex)
+    FileOwnerIndexPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "isodate.h"
+
+#include <QTimeZone>
+
+using namespace PackageKit;
+
+namespace {
+
+// Reads the \p count digits at \p pos, returns -1 if one is not a digit
+int digits(QStringView string, qsizetype pos, int count)
+{
+    int value = 0;
+    for (qsizetype i = pos; i < pos + count; ++i) {
+        const char16_t c = string[i].unicode();
+        if (c < u'0' || c > u'9') {
+            return -1;
+        }
+        value = value * 10 + (c - u'0');
+    }
+    return value;
+}
+
+bool isLeapYear(int year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int daysInMonth(int year, int month)
+{
+    static const int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return month == 2 && isLeapYear(year) ? 29 : days[month - 1];
+}
+
+// Days between 1970-01-01 and the given date of the proleptic Gregorian
+// calendar, Howard Hinnant's days_from_civil()
+qint64 daysFromCivil(int year, int month, int day)
+{
+    year -= month <= 2;
+    const int era = (year >= 0 ? year : year - 399) / 400;
+    const int yearOfEra = year - era * 400;
+    const int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return qint64(era) * 146097 + dayOfEra - 719468;
+}
+
+}
+
+bool IsoDate::parse(QStringView string, qint64 *msecs, int *offset)
+{
+    // YYYY-MM-DDTHH:MM:SS is the shortest form taken here
+    const qsizetype size = string.size();
+    if (size < 20 || string[4] != u'-' || string[7] != u'-' || string[10] != u'T'
+            || string[13] != u':' || string[16] != u':') {
+        return false;
+    }
+
+    const int year = digits(string, 0, 4);
+    const int month = digits(string, 5, 2);
+    const int day = digits(string, 8, 2);
+    const int hour = digits(string, 11, 2);
+    const int minute = digits(string, 14, 2);
+    const int second = digits(string, 17, 2);
+    if (year < 0 || month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)
+            || hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59) {
+        return false;
+    }
+
+    // Fractions are rounded to milliseconds, like QDateTime does
+    qsizetype pos = 19;
+    int msec = 0;
+    if (string[pos] == u'.' || string[pos] == u',') {
+        const qsizetype start = ++pos;
+        qint64 fraction = 0;
+        qint64 scale = 1;
+        while (pos < size && string[pos] >= u'0' && string[pos] <= u'9') {
+            if (scale < Q_INT64_C(1000000000000)) {
+                fraction = fraction * 10 + (string[pos].unicode() - u'0');
+                scale *= 10;
+            }
+            ++pos;
+        }
+        if (pos == start) {
+            return false;
+        }
+        msec = int(qMin<qint64>((fraction * 2000 / scale + 1) / 2, 999));
+    }
+
+    int offsetSeconds = 0;
+    if (pos + 1 == size && string[pos] == u'Z') {
+        offsetSeconds = 0;
+    } else if (pos < size && (string[pos] == u'+' || string[pos] == u'-')) {
+        // ±HH:MM or ±HHMM
+        const qsizetype remaining = size - pos - 1;
+        const bool colon = remaining == 5 && string[pos + 3] == u':';
+        if (!colon && remaining != 4) {
+            return false;
+        }
+        const int offsetHours = digits(string, pos + 1, 2);
+        const int offsetMinutes = digits(string, pos + (colon ? 4 : 3), 2);
+        if (offsetHours < 0 || offsetHours > 23 || offsetMinutes < 0 || offsetMinutes > 59) {
+            return false;
+        }
+        offsetSeconds = (offsetHours * 60 + offsetMinutes) * 60;
+        if (string[pos] == u'-') {
+            offsetSeconds = -offsetSeconds;
+        }
+    } else {
+        // Without a zone the time is local, leave that to QDateTime
+        return false;
+    }
+
+    const qint64 seconds = daysFromCivil(year, month, day) * 86400
+            + hour * 3600 + minute * 60 + second - offsetSeconds;
+    *msecs = seconds * 1000 + msec;
+    *offset = offsetSeconds;
+    return true;
+}
+
+qint64 IsoDate::toMSecsSinceEpoch(QStringView string, bool *ok)
+{
+    qint64 msecs;
+    int offset;
+    bool valid = parse(string, &msecs, &offset);
+    if (!valid) {
+        const QDateTime dateTime = QDateTime::fromString(string.toString(), Qt::ISODate);
+        valid = dateTime.isValid();
+        msecs = valid ? dateTime.toMSecsSinceEpoch() : 0;
+    }
+    if (ok) {
+        *ok = valid;
+    }
+    return msecs;
+}
+
+QDateTime IsoDate::toDateTime(QStringView string)
+{
+    qint64 msecs;
+    int offset;
+    if (!parse(string, &msecs, &offset)) {
+        return QDateTime::fromString(string.toString(), Qt::ISODate);
+    }
+    return QDateTime::fromMSecsSinceEpoch(msecs, offset == 0 ? QTimeZone(QTimeZone::UTC)
+                                                             : QTimeZone::fromSecondsAheadOfUtc(offset));
+}
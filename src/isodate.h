@@ -0,0 +1,61 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_ISO_DATE_H
+#define PACKAGEKIT_ISO_DATE_H
+
+#include <QDateTime>
+#include <QStringView>
+
+namespace PackageKit {
+
+/**
+ * Parses the timestamps PackageKit sends in update details and the
+ * transaction list
+ *
+ * The daemon formats them with g_date_time_format_iso8601(), so they
+ * always look like "2026-01-01T12:00:00Z", maybe with a fraction of a
+ * second or a "+02:00" offset. Those are parsed directly, which is much
+ * cheaper than QDateTime::fromString(). Everything else, like dates
+ * without a time or a zone, is handed to QDateTime::fromString() with
+ * Qt::ISODate, so the results never differ.
+ */
+class IsoDate
+{
+public:
+    /**
+     * Returns the msecs since the epoch of \p string, \p ok is set
+     * to \c false and 0 is returned if it is not a valid date
+     */
+    static qint64 toMSecsSinceEpoch(QStringView string, bool *ok = nullptr);
+
+    /**
+     * Returns \p string as a QDateTime, which is invalid if
+     * \p string is not a valid date
+     */
+    static QDateTime toDateTime(QStringView string);
+
+private:
+    static bool parse(QStringView string, qint64 *msecs, int *offset);
+};
+
+} // End namespace PackageKit
+
+#endif
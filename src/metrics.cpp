@@ -0,0 +1,150 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "metrics.h"
+#include "metricsprivate.h"
+
+#include <QCoreApplication>
+#include <QLoggingCategory>
+#include <QSaveFile>
+#include <QTimer>
+
+Q_DECLARE_LOGGING_CATEGORY(PACKAGEKITQT_DAEMON)
+
+using namespace PackageKit;
+
+namespace PackageKit {
+
+namespace MetricsPrivate {
+
+std::atomic<bool> enabled(false);
+std::atomic<quint64> counters[CounterCount] = {};
+
+static std::atomic<quint64> liveTransactions(0);
+static std::atomic<quint64> peakTransactions(0);
+
+void transactionCreated()
+{
+    const quint64 live = liveTransactions.fetch_add(1, std::memory_order_relaxed) + 1;
+    quint64 peak = peakTransactions.load(std::memory_order_relaxed);
+    while (live > peak && !peakTransactions.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void transactionDestroyed()
+{
+    liveTransactions.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}
+
+}
+
+static QTimer *s_exportTimer = nullptr;
+static QString s_exportFileName;
+
+static void appendMetric(QByteArray &text, const char *name, const char *type, const char *help, quint64 value)
+{
+    const bool counter = qstrcmp(type, "counter") == 0;
+    text += QByteArray("# TYPE packagekitqt_") + name + ' ' + type + '\n';
+    text += QByteArray("# HELP packagekitqt_") + name + ' ' + help + '\n';
+    text += QByteArray("packagekitqt_") + name + (counter ? "_total " : " ") + QByteArray::number(value) + '\n';
+}
+
+QByteArray Metrics::Snapshot::toOpenMetrics() const
+{
+    QByteArray text;
+    appendMetric(text, "method_calls", "counter", "D-Bus method calls issued to PackageKit.", methodCalls);
+    appendMetric(text, "signals_received", "counter", "D-Bus signals received from PackageKit.", signalsReceived);
+    appendMetric(text, "decoded_bytes", "counter", "Approximate size of the Packages and UpdateDetails payloads decoded.", bytesDecoded);
+    appendMetric(text, "packages_emitted", "counter", "Transaction::package() emissions.", packagesEmitted);
+    appendMetric(text, "queued_property_notifications", "counter", "Property change notifications queued by transactions.", queuedPropertyNotifications);
+    appendMetric(text, "live_transactions", "gauge", "Transaction objects currently alive.", liveTransactions);
+    appendMetric(text, "peak_transactions", "gauge", "The highest number of Transaction objects alive at once.", peakTransactions);
+    text += "# EOF\n";
+    return text;
+}
+
+void Metrics::setEnabled(bool enabled)
+{
+    MetricsPrivate::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Metrics::isEnabled()
+{
+    return MetricsPrivate::isEnabled();
+}
+
+Metrics::Snapshot Metrics::snapshot()
+{
+    using namespace MetricsPrivate;
+
+    Snapshot snapshot;
+    snapshot.methodCalls = counters[MethodCalls].load(std::memory_order_relaxed);
+    snapshot.signalsReceived = counters[SignalsReceived].load(std::memory_order_relaxed);
+    snapshot.bytesDecoded = counters[BytesDecoded].load(std::memory_order_relaxed);
+    snapshot.packagesEmitted = counters[PackagesEmitted].load(std::memory_order_relaxed);
+    snapshot.queuedPropertyNotifications = counters[QueuedPropertyNotifications].load(std::memory_order_relaxed);
+    snapshot.liveTransactions = liveTransactions.load(std::memory_order_relaxed);
+    snapshot.peakTransactions = peakTransactions.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void Metrics::reset()
+{
+    using namespace MetricsPrivate;
+
+    for (std::atomic<quint64> &counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    peakTransactions.store(liveTransactions.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+bool Metrics::writeOpenMetrics(const QString &fileName)
+{
+    // Readers never see a partially written file
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(PACKAGEKITQT_DAEMON) << "Failed to write metrics to" << fileName << file.errorString();
+        return false;
+    }
+    file.write(snapshot().toOpenMetrics());
+    return file.commit();
+}
+
+void Metrics::setExportFile(const QString &fileName, int interval)
+{
+    s_exportFileName = fileName;
+    if (fileName.isEmpty()) {
+        delete s_exportTimer;
+        s_exportTimer = nullptr;
+        return;
+    }
+
+    setEnabled(true);
+    if (!s_exportTimer) {
+        s_exportTimer = new QTimer(QCoreApplication::instance());
+        QObject::connect(s_exportTimer, &QTimer::timeout, [] {
+            writeOpenMetrics(s_exportFileName);
+        });
+    }
+    s_exportTimer->start(interval);
+    writeOpenMetrics(fileName);
+}
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_METRICS_H
+#define PACKAGEKIT_METRICS_H
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#include <packagekitqt_global.h>
+
+namespace PackageKit {
+
+/**
+ * \class Metrics metrics.h Metrics
+ *
+ * \brief Counters of the work done by the library
+ *
+ * Counting is off by default, call setEnabled() first. The counters
+ * are shared by all threads and only ever increase, except the number of
+ * live transactions which is always kept.
+ *
+ * The counters can be written in the OpenMetrics text format, once with
+ * writeOpenMetrics() or periodically with setExportFile(), for a
+ * monitoring agent to pick them up.
+ */
+class PACKAGEKITQT_LIBRARY Metrics
+{
+public:
+    /**
+     * The value of every counter at one point in time
+     */
+    struct Snapshot {
+        /** D-Bus method calls issued to PackageKit */
+        quint64 methodCalls = 0;
+        /** D-Bus signals received from PackageKit */
+        quint64 signalsReceived = 0;
+        /** Approximate size of the Packages and UpdateDetails payloads decoded */
+        quint64 bytesDecoded = 0;
+        /** Transaction::package() emissions */
+        quint64 packagesEmitted = 0;
+        /** Property change notifications queued by transactions */
+        quint64 queuedPropertyNotifications = 0;
+        /** Transaction objects currently alive */
+        quint64 liveTransactions = 0;
+        /** The highest number of Transaction objects alive at once */
+        quint64 peakTransactions = 0;
+
+        /**
+         * Returns the counters in the OpenMetrics text format
+         */
+        QByteArray toOpenMetrics() const;
+    };
+
+    /**
+     * Turns counting on or off, transactions that were already
+     * running when it is turned on are only partly counted
+     */
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static Snapshot snapshot();
+
+    /**
+     * Sets all counters but the live transactions back to 0
+     */
+    static void reset();
+
+    /**
+     * Replaces \p fileName with the current counters in the OpenMetrics text format
+     */
+    static bool writeOpenMetrics(const QString &fileName);
+
+    /**
+     * \brief Writes the counters to \p fileName every \p interval milliseconds
+     *
+     * This also enables counting. An empty \p fileName stops the export,
+     * counting stays enabled. Must be called from the main thread.
+     *
+     * \sa writeOpenMetrics()
+     */
+    static void setExportFile(const QString &fileName, int interval = 10000);
+};
+
+} // End namespace PackageKit
+
+#endif
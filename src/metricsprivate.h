@@ -0,0 +1,63 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_METRICS_PRIVATE_H
+#define PACKAGEKIT_METRICS_PRIVATE_H
+
+#include <QtGlobal>
+
+#include <atomic>
+
+namespace PackageKit {
+
+namespace MetricsPrivate {
+
+enum Counter {
+    MethodCalls,
+    SignalsReceived,
+    BytesDecoded,
+    PackagesEmitted,
+    QueuedPropertyNotifications,
+    CounterCount
+};
+
+extern std::atomic<bool> enabled;
+extern std::atomic<quint64> counters[CounterCount];
+
+inline bool isEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+inline void add(Counter counter, quint64 value = 1)
+{
+    if (isEnabled()) {
+        counters[counter].fetch_add(value, std::memory_order_relaxed);
+    }
+}
+
+void transactionCreated();
+void transactionDestroyed();
+
+}
+
+} // End namespace PackageKit
+
+#endif
@@ -18,6 +18,7 @@
  * Boston, MA 02110-1301, USA.
  */
 #include "offline_p.h"
+#include "metricsprivate.h"
 
 Q_DECLARE_LOGGING_CATEGORY(PACKAGEKITQT_OFFLINE)
 
@@ -71,12 +72,6 @@ QString Offline::Results::errorDescription() const
 Offline::Offline(QObject *parent) : QObject(parent)
   , d_ptr(new OfflinePrivate(this))
 {
-    QDBusConnection::systemBus().connect(PK_NAME,
-                                         PK_PATH,
-                                         DBUS_PROPERTIES,
-                                         QLatin1String("PropertiesChanged"),
-                                         this,
-                                         SLOT(updateProperties(QString,QVariantMap,QStringList)));
 }
 
 Offline::~Offline()
@@ -145,7 +140,8 @@ QDBusPendingReply<> Offline::trigger(Action action)
                                               QStringLiteral("Trigger"));
     msg << actionStr;
     msg.setInteractiveAuthorizationAllowed(true);
-    return QDBusConnection::systemBus().asyncCall(msg);
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    return Daemon::connection().asyncCall(msg);
 }
 
 QDBusPendingReply<> Offline::triggerUpgrade(Action action)
@@ -173,11 +169,14 @@ QDBusPendingReply<> Offline::triggerUpgrade(Action action)
                                               QStringLiteral("TriggerUpgrade"));
     msg << actionStr;
     msg.setInteractiveAuthorizationAllowed(true);
-    return QDBusConnection::systemBus().asyncCall(msg, 24 * 60 * 1000 * 1000);
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    return Daemon::connection().asyncCall(msg, 24 * 60 * 1000 * 1000);
 }
 
 Offline::Results Offline::getResults()
 {
+    Q_D(Offline);
+
     // Manually invoke dbus because the qdbusxml2cpp does not allow
     // setting the ALLOW_INTERACTIVE_AUTHORIZATION flag
     auto msg = QDBusMessage::createMethodCall(PK_NAME,
@@ -185,11 +184,14 @@ Offline::Results Offline::getResults()
                                               PK_OFFLINE_INTERFACE,
                                               QStringLiteral("GetResults"));
     msg.setInteractiveAuthorizationAllowed(true);
-    return QDBusConnection::systemBus().asyncCall(msg, 24 * 60 * 1000 * 1000);
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    return Daemon::connection().asyncCall(msg, 24 * 60 * 1000 * 1000);
 }
 
 QDBusPendingReply<> Offline::cancel()
 {
+    Q_D(Offline);
+
     // Manually invoke dbus because the qdbusxml2cpp does not allow
     // setting the ALLOW_INTERACTIVE_AUTHORIZATION flag
     auto msg = QDBusMessage::createMethodCall(PK_NAME,
@@ -197,11 +199,14 @@ QDBusPendingReply<> Offline::cancel()
                                               PK_OFFLINE_INTERFACE,
                                               QStringLiteral("Cancel"));
     msg.setInteractiveAuthorizationAllowed(true);
-    return QDBusConnection::systemBus().asyncCall(msg);
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    return Daemon::connection().asyncCall(msg);
 }
 
 QDBusPendingReply<> Offline::clearResults()
 {
+    Q_D(Offline);
+
     // Manually invoke dbus because the qdbusxml2cpp does not allow
     // setting the ALLOW_INTERACTIVE_AUTHORIZATION flag
     auto msg = QDBusMessage::createMethodCall(PK_NAME,
@@ -209,13 +214,19 @@ QDBusPendingReply<> Offline::clearResults()
                                               PK_OFFLINE_INTERFACE,
                                               QStringLiteral("ClearResults"));
     msg.setInteractiveAuthorizationAllowed(true);
-    return QDBusConnection::systemBus().asyncCall(msg);
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    return Daemon::connection().asyncCall(msg);
 }
 
 void Offline::getPrepared()
 {
     Q_D(Offline);
-    QDBusPendingReply<QStringList> reply = d->iface.GetPrepared();
+    QDBusMessage msg = QDBusMessage::createMethodCall(PK_NAME,
+                                                      PK_PATH,
+                                                      PK_OFFLINE_INTERFACE,
+                                                      QStringLiteral("GetPrepared"));
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    QDBusPendingReply<QStringList> reply = Daemon::connection().asyncCall(msg);
     auto watcher = new QDBusPendingCallWatcher(reply, this);
     connect(watcher, &QDBusPendingCallWatcher::finished, this, [=] (QDBusPendingCallWatcher *call) {
         QDBusPendingReply<QStringList> reply = *call;
@@ -29,7 +29,7 @@ class OfflinePrivate
 {
     Q_DECLARE_PUBLIC(Offline)
 public:
-    OfflinePrivate(Offline *q) : q_ptr(q), iface(PK_NAME, PK_PATH, QDBusConnection::systemBus())
+    OfflinePrivate(Offline *q) : q_ptr(q)
     {
     }
 
@@ -37,7 +37,6 @@ public:
     void updateProperties(const QString &interface, const QVariantMap &properties, const QStringList &invalidate);
 
     Offline *q_ptr;
-    OrgFreedesktopPackageKitOfflineInterface iface;
     QVariantMap preparedUpgrade;
     Offline::Action triggerAction = Offline::ActionUnset;
     QMap<QString, bool> m_properties;
@@ -0,0 +1,250 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packagedetails.h"
+
+namespace PackageKit {
+
+class PackageDetailsData : public QSharedData
+{
+public:
+    QString packageId;
+    QString summary;
+    QString description;
+    QString url;
+    QString license;
+    qulonglong size = 0;
+    qulonglong downloadSize = 0;
+    Transaction::Group group = Transaction::GroupUnknown;
+    // One bit per Field that was set
+    uint fields = 0;
+    // Whatever has no Field
+    QVariantMap extra;
+};
+
+}
+
+using namespace PackageKit;
+
+PackageDetails::PackageDetails() = default;
+
+PackageDetails::PackageDetails(const QVariantMap &values)
+    : d(new PackageDetailsData)
+{
+    for (auto it = values.constBegin(); it != values.constEnd(); ++it) {
+        insert(it.key(), it.value());
+    }
+}
+
+PackageDetails::PackageDetails(const PackageDetails &other) = default;
+
+PackageDetails::~PackageDetails() = default;
+
+PackageDetails &PackageDetails::operator=(const PackageDetails &other) = default;
+
+bool PackageDetails::isValid() const
+{
+    return bool(d);
+}
+
+bool PackageDetails::contains(Field field) const
+{
+    return d && field != FieldUnknown && (d->fields & (1u << field));
+}
+
+QString PackageDetails::packageId() const
+{
+    return d ? d->packageId : QString();
+}
+
+QString PackageDetails::summary() const
+{
+    return d ? d->summary : QString();
+}
+
+QString PackageDetails::description() const
+{
+    return d ? d->description : QString();
+}
+
+Transaction::Group PackageDetails::group() const
+{
+    return d ? d->group : Transaction::GroupUnknown;
+}
+
+QString PackageDetails::url() const
+{
+    return d ? d->url : QString();
+}
+
+QString PackageDetails::license() const
+{
+    return d ? d->license : QString();
+}
+
+qulonglong PackageDetails::size() const
+{
+    return d ? d->size : 0;
+}
+
+qulonglong PackageDetails::downloadSize() const
+{
+    return d ? d->downloadSize : 0;
+}
+
+void PackageDetails::insert(const QString &key, const QVariant &value)
+{
+    if (d) {
+        d.detach();
+    } else {
+        d = new PackageDetailsData;
+    }
+
+    const Field field = fieldFromKey(key);
+    switch (field) {
+    case FieldUnknown:
+        d->extra.insert(key, value);
+        return;
+    case FieldPackageId:
+        d->packageId = value.toString();
+        break;
+    case FieldSummary:
+        d->summary = value.toString();
+        break;
+    case FieldDescription:
+        d->description = value.toString();
+        break;
+    case FieldGroup:
+        d->group = static_cast<Transaction::Group>(value.toUInt());
+        break;
+    case FieldUrl:
+        d->url = value.toString();
+        break;
+    case FieldLicense:
+        d->license = value.toString();
+        break;
+    case FieldSize:
+        d->size = value.toULongLong();
+        break;
+    case FieldDownloadSize:
+        d->downloadSize = value.toULongLong();
+        break;
+    }
+    d->fields |= 1u << field;
+}
+
+QVariantMap PackageDetails::toVariantMap() const
+{
+    if (!d) {
+        return QVariantMap();
+    }
+
+    QVariantMap values = d->extra;
+    for (int i = FieldPackageId; i <= FieldDownloadSize; ++i) {
+        const auto field = static_cast<Field>(i);
+        if (!contains(field)) {
+            continue;
+        }
+
+        QVariant value;
+        switch (field) {
+        case FieldUnknown:
+            break;
+        case FieldPackageId:
+            value = d->packageId;
+            break;
+        case FieldSummary:
+            value = d->summary;
+            break;
+        case FieldDescription:
+            value = d->description;
+            break;
+        case FieldGroup:
+            value = uint(d->group);
+            break;
+        case FieldUrl:
+            value = d->url;
+            break;
+        case FieldLicense:
+            value = d->license;
+            break;
+        case FieldSize:
+            value = d->size;
+            break;
+        case FieldDownloadSize:
+            value = d->downloadSize;
+            break;
+        }
+        values.insert(keyFromField(field), value);
+    }
+    return values;
+}
+
+PackageDetails::Field PackageDetails::fieldFromKey(QStringView key)
+{
+    // The lengths of the keys are nearly unique, so at most
+    // two strings are compared
+    switch (key.size()) {
+    case 3:
+        return key == QLatin1String("url") ? FieldUrl : FieldUnknown;
+    case 4:
+        return key == QLatin1String("size") ? FieldSize : FieldUnknown;
+    case 5:
+        return key == QLatin1String("group") ? FieldGroup : FieldUnknown;
+    case 7:
+        if (key == QLatin1String("summary")) {
+            return FieldSummary;
+        }
+        return key == QLatin1String("license") ? FieldLicense : FieldUnknown;
+    case 10:
+        return key == QLatin1String("package-id") ? FieldPackageId : FieldUnknown;
+    case 11:
+        return key == QLatin1String("description") ? FieldDescription : FieldUnknown;
+    case 13:
+        return key == QLatin1String("download-size") ? FieldDownloadSize : FieldUnknown;
+    default:
+        return FieldUnknown;
+    }
+}
+
+QString PackageDetails::keyFromField(Field field)
+{
+    switch (field) {
+    case FieldPackageId:
+        return QStringLiteral("package-id");
+    case FieldSummary:
+        return QStringLiteral("summary");
+    case FieldDescription:
+        return QStringLiteral("description");
+    case FieldGroup:
+        return QStringLiteral("group");
+    case FieldUrl:
+        return QStringLiteral("url");
+    case FieldLicense:
+        return QStringLiteral("license");
+    case FieldSize:
+        return QStringLiteral("size");
+    case FieldDownloadSize:
+        return QStringLiteral("download-size");
+    case FieldUnknown:
+        break;
+    }
+    return QString();
+}
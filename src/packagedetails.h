@@ -0,0 +1,137 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_PACKAGE_DETAILS_H
+#define PACKAGEKIT_PACKAGE_DETAILS_H
+
+#include <QtCore/QExplicitlySharedDataPointer>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+#include <QtCore/QStringView>
+#include <QtCore/QVariantMap>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class PackageDetails packagedetails.h PackageDetails
+ *
+ * \brief The details of one package
+ *
+ * Holds the same data as Details, but the fields the daemon knows about
+ * are stored as members and filled straight from the D-Bus message, so
+ * reading them needs no map lookup nor QVariant conversion. Keys the
+ * library doesn't know are kept aside and still show up in toVariantMap().
+ *
+ * This class is implicitly shared.
+ *
+ * \sa Transaction::packageDetails(), Daemon::getDetails()
+ */
+class PackageDetailsData;
+class PACKAGEKITQT_LIBRARY PackageDetails
+{
+public:
+    /**
+     * Describes the known keys of the details dictionary
+     */
+    enum Field {
+        FieldUnknown,
+        FieldPackageId,     /** < "package-id" */
+        FieldSummary,       /** < "summary" */
+        FieldDescription,   /** < "description" */
+        FieldGroup,         /** < "group" */
+        FieldUrl,           /** < "url" */
+        FieldLicense,       /** < "license" */
+        FieldSize,          /** < "size" */
+        FieldDownloadSize   /** < "download-size" */
+    };
+
+    PackageDetails();
+    explicit PackageDetails(const QVariantMap &values);
+    PackageDetails(const PackageDetails &other);
+    ~PackageDetails();
+
+    PackageDetails &operator=(const PackageDetails &other);
+
+    bool isValid() const;
+
+    /**
+     * Returns \c true if the daemon sent a value for \p field
+     */
+    bool contains(Field field) const;
+
+    QString packageId() const;
+
+    QString summary() const;
+
+    QString description() const;
+
+    Transaction::Group group() const;
+
+    QString url() const;
+
+    QString license() const;
+
+    /**
+     * The installed size of the package in bytes
+     */
+    qulonglong size() const;
+
+    /**
+     * The number of bytes still to download, not sent by all backends
+     */
+    qulonglong downloadSize() const;
+
+    /**
+     * Sets \p key to \p value, as done for every entry of the details
+     * dictionary sent by the daemon
+     */
+    void insert(const QString &key, const QVariant &value);
+
+    /**
+     * Returns all the values in the form of the dictionary sent by the daemon
+     * \sa Details
+     */
+    QVariantMap toVariantMap() const;
+
+    /**
+     * Returns the field stored under \p key, or FieldUnknown
+     */
+    static Field fieldFromKey(QStringView key);
+
+    /**
+     * Returns the key of \p field in the details dictionary
+     */
+    static QString keyFromField(Field field);
+
+private:
+    QExplicitlySharedDataPointer<PackageDetailsData> d;
+};
+
+typedef QList<PackageDetails> PackageDetailsList;
+
+} // End namespace PackageKit
+
+Q_DECLARE_METATYPE(PackageKit::PackageDetails)
+
+#endif
@@ -0,0 +1,264 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packagemodel.h"
+
+#include <QList>
+#include <QStringList>
+
+namespace PackageKit {
+
+class PackageModelPrivate
+{
+public:
+    // Where the ';' separators of a package ID are, or its size if missing
+    struct Separators {
+        int first;
+        int second;
+        int third;
+    };
+
+    QStringView part(int row, int role) const;
+
+    // One entry per package, the rows past inserted are still pending
+    QStringList packageIds;
+    QStringList summaries;
+    QStringList nameKeys;
+    QList<QByteArray> versionKeys;
+    QList<Separators> separators;
+    QList<quint8> infos;
+    VersionCompare::Scheme scheme = VersionCompare::SchemeRpm;
+    int inserted = 0;
+    bool flushQueued = false;
+};
+
+}
+
+using namespace PackageKit;
+
+QStringView PackageModelPrivate::part(int row, int role) const
+{
+    const QStringView packageId = packageIds.at(row);
+    const Separators &sep = separators.at(row);
+    switch (role) {
+    case PackageModel::NameRole:
+        return packageId.first(sep.first);
+    case PackageModel::VersionRole:
+        return sep.first < sep.second ? packageId.sliced(sep.first + 1, sep.second - sep.first - 1) : QStringView();
+    case PackageModel::ArchRole:
+        return sep.second < sep.third ? packageId.sliced(sep.second + 1, sep.third - sep.second - 1) : QStringView();
+    case PackageModel::RepoRole:
+        return sep.third < packageId.size() ? packageId.sliced(sep.third + 1) : QStringView();
+    }
+    return QStringView();
+}
+
+PackageModel::PackageModel(QObject *parent)
+    : QAbstractListModel(parent)
+    , d_ptr(new PackageModelPrivate)
+{
+}
+
+PackageModel::~PackageModel()
+{
+    delete d_ptr;
+}
+
+void PackageModel::addTransaction(Transaction *transaction)
+{
+    connect(transaction, &Transaction::package, this, &PackageModel::addPackage);
+    connect(transaction, &Transaction::finished, this, &PackageModel::flush);
+}
+
+int PackageModel::count() const
+{
+    Q_D(const PackageModel);
+    return d->inserted;
+}
+
+QString PackageModel::packageId(int row) const
+{
+    Q_D(const PackageModel);
+    return row >= 0 && row < d->inserted ? d->packageIds.at(row) : QString();
+}
+
+Transaction::Info PackageModel::info(int row) const
+{
+    Q_D(const PackageModel);
+    return row >= 0 && row < d->inserted ? static_cast<Transaction::Info>(d->infos.at(row)) : Transaction::InfoUnknown;
+}
+
+QString PackageModel::summary(int row) const
+{
+    Q_D(const PackageModel);
+    return row >= 0 && row < d->inserted ? d->summaries.at(row) : QString();
+}
+
+QString PackageModel::nameKey(int row) const
+{
+    Q_D(const PackageModel);
+    return row >= 0 && row < d->inserted ? d->nameKeys.at(row) : QString();
+}
+
+QByteArray PackageModel::versionKey(int row) const
+{
+    Q_D(const PackageModel);
+    return row >= 0 && row < d->inserted ? d->versionKeys.at(row) : QByteArray();
+}
+
+VersionCompare::Scheme PackageModel::versionScheme() const
+{
+    Q_D(const PackageModel);
+    return d->scheme;
+}
+
+void PackageModel::setVersionScheme(VersionCompare::Scheme scheme)
+{
+    Q_D(PackageModel);
+    if (d->scheme == scheme) {
+        return;
+    }
+
+    d->scheme = scheme;
+    for (int row = 0; row < d->versionKeys.size(); ++row) {
+        d->versionKeys[row] = VersionCompare::sortKey(d->part(row, VersionRole), scheme);
+    }
+
+    // Lets a proxy sorted by version sort again
+    if (d->inserted > 0) {
+        Q_EMIT dataChanged(index(0), index(d->inserted - 1), { VersionRole });
+    }
+}
+
+int PackageModel::rowCount(const QModelIndex &parent) const
+{
+    Q_D(const PackageModel);
+    return parent.isValid() ? 0 : d->inserted;
+}
+
+QVariant PackageModel::data(const QModelIndex &index, int role) const
+{
+    Q_D(const PackageModel);
+    if (!index.isValid() || index.row() >= d->inserted) {
+        return QVariant();
+    }
+
+    const int row = index.row();
+    switch (role) {
+    case Qt::DisplayRole:
+        return d->part(row, NameRole).toString();
+    case PackageIdRole:
+        return d->packageIds.at(row);
+    case NameRole:
+    case VersionRole:
+    case ArchRole:
+    case RepoRole:
+        return d->part(row, role).toString();
+    case InfoRole:
+        return QVariant::fromValue(static_cast<Transaction::Info>(d->infos.at(row)));
+    case SummaryRole:
+        return d->summaries.at(row);
+    }
+    return QVariant();
+}
+
+QHash<int, QByteArray> PackageModel::roleNames() const
+{
+    QHash<int, QByteArray> roles = QAbstractListModel::roleNames();
+    roles.insert(PackageIdRole, "packageId");
+    roles.insert(NameRole, "name");
+    roles.insert(VersionRole, "version");
+    roles.insert(ArchRole, "arch");
+    roles.insert(RepoRole, "repo");
+    roles.insert(InfoRole, "info");
+    roles.insert(SummaryRole, "summary");
+    return roles;
+}
+
+void PackageModel::addPackage(Transaction::Info info, const QString &packageID, const QString &summary)
+{
+    Q_D(PackageModel);
+
+    const int size = int(packageID.size());
+    PackageModelPrivate::Separators sep{ size, size, size };
+    const qsizetype first = packageID.indexOf(QLatin1Char(';'));
+    if (first != -1) {
+        sep.first = int(first);
+        const qsizetype second = packageID.indexOf(QLatin1Char(';'), first + 1);
+        if (second != -1) {
+            sep.second = int(second);
+            const qsizetype third = packageID.indexOf(QLatin1Char(';'), second + 1);
+            if (third != -1) {
+                sep.third = int(third);
+            }
+        }
+    }
+
+    d->packageIds.append(packageID);
+    d->summaries.append(summary);
+    d->nameKeys.append(QStringView(packageID).first(sep.first).toString().toCaseFolded());
+    d->separators.append(sep);
+    d->versionKeys.append(VersionCompare::sortKey(d->part(int(d->packageIds.size()) - 1, VersionRole), d->scheme));
+    d->infos.append(quint8(info));
+
+    // Everything a Packages signal carries ends up in the same chunk
+    if (!d->flushQueued) {
+        d->flushQueued = true;
+        QMetaObject::invokeMethod(this, &PackageModel::flush, Qt::QueuedConnection);
+    }
+}
+
+void PackageModel::flush()
+{
+    Q_D(PackageModel);
+    d->flushQueued = false;
+
+    const int size = int(d->packageIds.size());
+    if (d->inserted == size) {
+        return;
+    }
+
+    beginInsertRows(QModelIndex(), d->inserted, size - 1);
+    d->inserted = size;
+    endInsertRows();
+    Q_EMIT countChanged();
+}
+
+void PackageModel::clear()
+{
+    Q_D(PackageModel);
+    const bool changed = d->inserted > 0;
+
+    beginResetModel();
+    d->packageIds.clear();
+    d->summaries.clear();
+    d->nameKeys.clear();
+    d->versionKeys.clear();
+    d->separators.clear();
+    d->infos.clear();
+    d->inserted = 0;
+    endResetModel();
+
+    if (changed) {
+        Q_EMIT countChanged();
+    }
+}
+
+#include "moc_packagemodel.cpp"
@@ -0,0 +1,130 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_PACKAGE_MODEL_H
+#define PACKAGEKIT_PACKAGE_MODEL_H
+
+#include <QtCore/QAbstractListModel>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+#include "versioncompare.h"
+
+namespace PackageKit {
+
+/**
+ * \class PackageModel packagemodel.h PackageModel
+ *
+ * \brief A list model of the packages sent by transactions
+ *
+ * Packages are collected as Transaction::package() sends them and inserted
+ * into the model in one chunk per event loop pass, so views see a handful
+ * of rowsInserted() signals instead of one per package. They are stored
+ * column by column, the parts of the package ID are only located once and
+ * a case folded copy of the name and a VersionCompare::sortKey() of the
+ * version are kept for PackageProxyModel.
+ *
+ * \sa PackageProxyModel
+ */
+class PackageModelPrivate;
+class PACKAGEKITQT_LIBRARY PackageModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+public:
+    enum Roles {
+        PackageIdRole = Qt::UserRole + 1,
+        NameRole,
+        VersionRole,
+        ArchRole,
+        RepoRole,    /** < The data part of the package ID, usually the repository */
+        InfoRole,
+        SummaryRole
+    };
+    Q_ENUM(Roles)
+
+    explicit PackageModel(QObject *parent = nullptr);
+    ~PackageModel() override;
+
+    /**
+     * Adds the packages \p transaction sends, the last ones
+     * are inserted right when it finishes
+     */
+    Q_INVOKABLE void addTransaction(PackageKit::Transaction *transaction);
+
+    /**
+     * Returns the number of rows, packages not inserted yet are not counted
+     */
+    int count() const;
+
+    QString packageId(int row) const;
+
+    Transaction::Info info(int row) const;
+
+    QString summary(int row) const;
+
+    /**
+     * Returns the case folded name of the package at \p row, computed when it was added
+     */
+    QString nameKey(int row) const;
+
+    /**
+     * Returns the VersionCompare::sortKey() of the version of the package at \p row,
+     * computed when it was added
+     */
+    QByteArray versionKey(int row) const;
+
+    /**
+     * The rules used for versionKey(), defaults to VersionCompare::SchemeRpm.
+     * Changing it computes the keys of all rows again.
+     */
+    VersionCompare::Scheme versionScheme() const;
+    void setVersionScheme(VersionCompare::Scheme scheme);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+public Q_SLOTS:
+    /**
+     * Adds a package, the arguments match the Transaction::package() signal.
+     * It is inserted with the next chunk.
+     */
+    void addPackage(PackageKit::Transaction::Info info, const QString &packageID, const QString &summary);
+
+    /**
+     * Inserts the packages added so far right away
+     */
+    void flush();
+
+    void clear();
+
+Q_SIGNALS:
+    void countChanged();
+
+private:
+    Q_DECLARE_PRIVATE(PackageModel)
+    PackageModelPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packageproxymodel.h"
+
+#include "packagemodel.h"
+
+#include <QPointer>
+
+namespace PackageKit {
+
+class PackageProxyModelPrivate
+{
+public:
+    // Set when the source is a PackageModel
+    QPointer<PackageModel> packageModel;
+    QString filterText;
+    QString filterKey;
+    Transaction::Info filterInfo = Transaction::InfoUnknown;
+};
+
+}
+
+using namespace PackageKit;
+
+PackageProxyModel::PackageProxyModel(QObject *parent)
+    : QSortFilterProxyModel(parent)
+    , d_ptr(new PackageProxyModelPrivate)
+{
+    setDynamicSortFilter(true);
+    setSortRole(PackageModel::NameRole);
+    sort(0);
+}
+
+PackageProxyModel::~PackageProxyModel()
+{
+    delete d_ptr;
+}
+
+void PackageProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    Q_D(PackageProxyModel);
+    d->packageModel = qobject_cast<PackageModel *>(sourceModel);
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+}
+
+QString PackageProxyModel::filterText() const
+{
+    Q_D(const PackageProxyModel);
+    return d->filterText;
+}
+
+void PackageProxyModel::setFilterText(const QString &text)
+{
+    Q_D(PackageProxyModel);
+    if (d->filterText == text) {
+        return;
+    }
+
+    d->filterText = text;
+    d->filterKey = text.toCaseFolded();
+    invalidateRowsFilter();
+    Q_EMIT filterTextChanged();
+}
+
+Transaction::Info PackageProxyModel::filterInfo() const
+{
+    Q_D(const PackageProxyModel);
+    return d->filterInfo;
+}
+
+void PackageProxyModel::setFilterInfo(Transaction::Info info)
+{
+    Q_D(PackageProxyModel);
+    if (d->filterInfo == info) {
+        return;
+    }
+
+    d->filterInfo = info;
+    invalidateRowsFilter();
+    Q_EMIT filterInfoChanged();
+}
+
+bool PackageProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    Q_D(const PackageProxyModel);
+    if (!d->packageModel) {
+        return QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
+    }
+
+    if (d->filterInfo != Transaction::InfoUnknown && d->packageModel->info(sourceRow) != d->filterInfo) {
+        return false;
+    }
+    return d->filterKey.isEmpty() || d->packageModel->nameKey(sourceRow).contains(d->filterKey);
+}
+
+bool PackageProxyModel::lessThan(const QModelIndex &sourceLeft, const QModelIndex &sourceRight) const
+{
+    Q_D(const PackageProxyModel);
+    const int role = sortRole();
+    if (!d->packageModel
+            || (role != Qt::DisplayRole && role != PackageModel::NameRole && role != PackageModel::PackageIdRole
+                && role != PackageModel::VersionRole)) {
+        return QSortFilterProxyModel::lessThan(sourceLeft, sourceRight);
+    }
+
+    if (role == PackageModel::VersionRole) {
+        const QByteArray left = d->packageModel->versionKey(sourceLeft.row());
+        const QByteArray right = d->packageModel->versionKey(sourceRight.row());
+        if (left != right) {
+            return left < right;
+        }
+    }
+
+    const int rc = d->packageModel->nameKey(sourceLeft.row()).compare(d->packageModel->nameKey(sourceRight.row()));
+    if (rc != 0) {
+        return rc < 0;
+    }
+    // Same name, keep versions and arches of it in a stable order
+    return d->packageModel->packageId(sourceLeft.row()) < d->packageModel->packageId(sourceRight.row());
+}
+
+#include "moc_packageproxymodel.cpp"
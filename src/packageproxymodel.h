@@ -0,0 +1,88 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_PACKAGE_PROXY_MODEL_H
+#define PACKAGEKIT_PACKAGE_PROXY_MODEL_H
+
+#include <QtCore/QSortFilterProxyModel>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class PackageProxyModel packageproxymodel.h PackageProxyModel
+ *
+ * \brief Sorts and filters a PackageModel
+ *
+ * Rows are sorted by name by default. Names are compared and matched
+ * against filterText() using the case folded keys PackageModel computed
+ * when the packages were added, without going through data(). Sorting by
+ * PackageModel::VersionRole likewise compares its version keys, so
+ * versions order the way the package manager does. As the
+ * sorting is dynamic, the chunks inserted into the source model are
+ * merged into the sorted rows instead of sorting everything again.
+ *
+ * Other source models are sorted and filtered the way
+ * QSortFilterProxyModel does.
+ */
+class PackageModel;
+class PackageProxyModelPrivate;
+class PACKAGEKITQT_LIBRARY PackageProxyModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+    Q_PROPERTY(QString filterText READ filterText WRITE setFilterText NOTIFY filterTextChanged)
+    Q_PROPERTY(PackageKit::Transaction::Info filterInfo READ filterInfo WRITE setFilterInfo NOTIFY filterInfoChanged)
+public:
+    explicit PackageProxyModel(QObject *parent = nullptr);
+    ~PackageProxyModel() override;
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    /**
+     * Only packages whose name contains \p text, ignoring case, are shown
+     */
+    QString filterText() const;
+    void setFilterText(const QString &text);
+
+    /**
+     * Only packages with \p info are shown, all of them for Transaction::InfoUnknown
+     */
+    Transaction::Info filterInfo() const;
+    void setFilterInfo(Transaction::Info info);
+
+Q_SIGNALS:
+    void filterTextChanged();
+    void filterInfoChanged();
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+    bool lessThan(const QModelIndex &sourceLeft, const QModelIndex &sourceRight) const override;
+
+private:
+    Q_DECLARE_PRIVATE(PackageProxyModel)
+    PackageProxyModelPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,355 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packagesnapshot.h"
+
+#include <QHashFunctions>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace PackageKit {
+
+class PackageSnapshotPrivate : public QSharedData
+{
+public:
+    template <typename T>
+    static void permute(QList<T> &column, const std::vector<qsizetype> &order);
+
+    bool lessThan(qsizetype a, qsizetype b) const;
+    int compareGroup(qsizetype row, const PackageSnapshotPrivate &other, qsizetype otherRow) const;
+    qsizetype groupEnd(qsizetype row) const;
+    void sort();
+
+    VersionCompare::Scheme scheme = VersionCompare::SchemeRpm;
+    bool sorted = true;
+
+    // One entry per package, all columns have the same size
+    QList<size_t> keyHashes;
+    QList<QString> packageIds;
+    QList<QString> summaries;
+    QList<quint8> infos;
+    QList<QByteArray> versionKeys;
+};
+
+}
+
+using namespace PackageKit;
+
+namespace {
+
+// Splits "name;version;arch;data" without allocating
+void splitPackageId(QStringView packageId, QStringView *name, QStringView *version, QStringView *arch)
+{
+    const qsizetype first = packageId.indexOf(QLatin1Char(';'));
+    if (first == -1) {
+        *name = packageId;
+        *version = QStringView();
+        *arch = QStringView();
+        return;
+    }
+    *name = packageId.first(first);
+
+    const qsizetype second = packageId.indexOf(QLatin1Char(';'), first + 1);
+    if (second == -1) {
+        *version = packageId.sliced(first + 1);
+        *arch = QStringView();
+        return;
+    }
+    *version = packageId.sliced(first + 1, second - first - 1);
+
+    const qsizetype third = packageId.indexOf(QLatin1Char(';'), second + 1);
+    *arch = third == -1 ? packageId.sliced(second + 1)
+                        : packageId.sliced(second + 1, third - second - 1);
+}
+
+int compareNameArch(QStringView packageIdA, QStringView packageIdB)
+{
+    QStringView nameA, versionA, archA;
+    QStringView nameB, versionB, archB;
+    splitPackageId(packageIdA, &nameA, &versionA, &archA);
+    splitPackageId(packageIdB, &nameB, &versionB, &archB);
+
+    int rc = nameA.compare(nameB);
+    if (rc == 0) {
+        rc = archA.compare(archB);
+    }
+    return rc;
+}
+
+} // namespace
+
+template <typename T>
+void PackageSnapshotPrivate::permute(QList<T> &column, const std::vector<qsizetype> &order)
+{
+    QList<T> sorted;
+    sorted.reserve(column.size());
+    for (qsizetype row : order) {
+        sorted.append(std::move(column[row]));
+    }
+    column = std::move(sorted);
+}
+
+bool PackageSnapshotPrivate::lessThan(qsizetype a, qsizetype b) const
+{
+    if (keyHashes[a] != keyHashes[b]) {
+        return keyHashes[a] < keyHashes[b];
+    }
+
+    const int rc = compareNameArch(packageIds[a], packageIds[b]);
+    if (rc != 0) {
+        return rc < 0;
+    }
+
+    if (versionKeys[a] != versionKeys[b]) {
+        return versionKeys[a] < versionKeys[b];
+    }
+    return packageIds[a] < packageIds[b];
+}
+
+int PackageSnapshotPrivate::compareGroup(qsizetype row, const PackageSnapshotPrivate &other, qsizetype otherRow) const
+{
+    if (keyHashes[row] != other.keyHashes[otherRow]) {
+        return keyHashes[row] < other.keyHashes[otherRow] ? -1 : 1;
+    }
+    return compareNameArch(packageIds[row], other.packageIds[otherRow]);
+}
+
+qsizetype PackageSnapshotPrivate::groupEnd(qsizetype row) const
+{
+    qsizetype end = row + 1;
+    while (end < packageIds.size() && compareGroup(row, *this, end) == 0) {
+        ++end;
+    }
+    return end;
+}
+
+void PackageSnapshotPrivate::sort()
+{
+    if (sorted) {
+        return;
+    }
+
+    std::vector<qsizetype> order(packageIds.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this] (qsizetype a, qsizetype b) {
+        return lessThan(a, b);
+    });
+
+    permute(keyHashes, order);
+    permute(packageIds, order);
+    permute(summaries, order);
+    permute(infos, order);
+    permute(versionKeys, order);
+    sorted = true;
+}
+
+PackageSnapshot::PackageSnapshot(VersionCompare::Scheme scheme)
+    : d(new PackageSnapshotPrivate)
+{
+    d->scheme = scheme;
+}
+
+PackageSnapshot::PackageSnapshot(const PackageSnapshot &other) = default;
+
+PackageSnapshot::~PackageSnapshot() = default;
+
+PackageSnapshot &PackageSnapshot::operator=(const PackageSnapshot &other) = default;
+
+VersionCompare::Scheme PackageSnapshot::scheme() const
+{
+    return d->scheme;
+}
+
+void PackageSnapshot::reserve(qsizetype size)
+{
+    d->keyHashes.reserve(size);
+    d->packageIds.reserve(size);
+    d->summaries.reserve(size);
+    d->infos.reserve(size);
+    d->versionKeys.reserve(size);
+}
+
+void PackageSnapshot::append(Transaction::Info info, const QString &packageID, const QString &summary)
+{
+    QStringView name, version, arch;
+    splitPackageId(packageID, &name, &version, &arch);
+
+    d->keyHashes.append(qHashMulti(0, name, arch));
+    d->packageIds.append(packageID);
+    d->summaries.append(summary);
+    d->infos.append(quint8(info));
+    d->versionKeys.append(VersionCompare::sortKey(version, d->scheme));
+
+    const qsizetype last = d->packageIds.size() - 1;
+    if (d->sorted && last > 0 && d->lessThan(last, last - 1)) {
+        d->sorted = false;
+    }
+}
+
+qsizetype PackageSnapshot::size() const
+{
+    return d->packageIds.size();
+}
+
+bool PackageSnapshot::isEmpty() const
+{
+    return d->packageIds.isEmpty();
+}
+
+void PackageSnapshot::clear()
+{
+    const VersionCompare::Scheme scheme = d->scheme;
+    d.reset(new PackageSnapshotPrivate);
+    d->scheme = scheme;
+}
+
+QString PackageSnapshot::packageId(qsizetype row) const
+{
+    return d->packageIds.value(row);
+}
+
+Transaction::Info PackageSnapshot::info(qsizetype row) const
+{
+    return static_cast<Transaction::Info>(d->infos.value(row));
+}
+
+QString PackageSnapshot::summary(qsizetype row) const
+{
+    return d->summaries.value(row);
+}
+
+void PackageSnapshot::sort()
+{
+    // Only detach when there is something to do
+    if (!d.constData()->sorted) {
+        d->sort();
+    }
+}
+
+bool PackageSnapshot::isSorted() const
+{
+    return d->sorted;
+}
+
+void PackageSnapshot::diff(const PackageSnapshot &older, const PackageSnapshot &newer, const ChangeCallback &callback)
+{
+    Q_ASSERT(older.scheme() == newer.scheme());
+
+    // Sort copies only when needed, sorted snapshots are just shared
+    PackageSnapshot sortedOlder = older;
+    PackageSnapshot sortedNewer = newer;
+    sortedOlder.sort();
+    sortedNewer.sort();
+    const PackageSnapshotPrivate &a = *sortedOlder.d.constData();
+    const PackageSnapshotPrivate &b = *sortedNewer.d.constData();
+
+    auto emitRow = [&callback] (PackageSnapshot::ChangeKind kind, const PackageSnapshotPrivate &snapshot, qsizetype row) {
+        Change change;
+        change.kind = kind;
+        if (kind == Removed) {
+            change.oldPackageId = snapshot.packageIds[row];
+        } else {
+            change.newPackageId = snapshot.packageIds[row];
+        }
+        change.info = static_cast<Transaction::Info>(snapshot.infos[row]);
+        change.summary = snapshot.summaries[row];
+        callback(change);
+    };
+
+    QList<qsizetype> oldOnly;
+    QList<qsizetype> newOnly;
+
+    qsizetype i = 0;
+    qsizetype j = 0;
+    while (i < a.packageIds.size() || j < b.packageIds.size()) {
+        int rc;
+        if (i == a.packageIds.size()) {
+            rc = 1;
+        } else if (j == b.packageIds.size()) {
+            rc = -1;
+        } else {
+            rc = a.compareGroup(i, b, j);
+        }
+
+        if (rc < 0) {
+            const qsizetype end = a.groupEnd(i);
+            for (; i < end; ++i) {
+                emitRow(Removed, a, i);
+            }
+            continue;
+        }
+        if (rc > 0) {
+            const qsizetype end = b.groupEnd(j);
+            for (; j < end; ++j) {
+                emitRow(Added, b, j);
+            }
+            continue;
+        }
+
+        // Same (name, arch) on both sides, rows are sorted by version
+        // so matching versions are found by merging the two groups
+        const qsizetype endA = a.groupEnd(i);
+        const qsizetype endB = b.groupEnd(j);
+        oldOnly.clear();
+        newOnly.clear();
+        while (i < endA || j < endB) {
+            if (j == endB || (i < endA && a.versionKeys[i] < b.versionKeys[j])) {
+                oldOnly.append(i++);
+            } else if (i == endA || b.versionKeys[j] < a.versionKeys[i]) {
+                newOnly.append(j++);
+            } else {
+                ++i;
+                ++j;
+            }
+        }
+
+        // Versions that only exist on one side are paired up in version
+        // order, anything left over was installed or removed alongside
+        const qsizetype pairs = qMin(oldOnly.size(), newOnly.size());
+        for (qsizetype k = 0; k < pairs; ++k) {
+            const qsizetype oldRow = oldOnly[k];
+            const qsizetype newRow = newOnly[k];
+            Change change;
+            change.kind = a.versionKeys[oldRow] < b.versionKeys[newRow] ? Upgraded : Downgraded;
+            change.oldPackageId = a.packageIds[oldRow];
+            change.newPackageId = b.packageIds[newRow];
+            change.info = static_cast<Transaction::Info>(b.infos[newRow]);
+            change.summary = b.summaries[newRow];
+            callback(change);
+        }
+        for (qsizetype k = pairs; k < oldOnly.size(); ++k) {
+            emitRow(Removed, a, oldOnly[k]);
+        }
+        for (qsizetype k = pairs; k < newOnly.size(); ++k) {
+            emitRow(Added, b, newOnly[k]);
+        }
+    }
+}
+
+QList<PackageSnapshot::Change> PackageSnapshot::diff(const PackageSnapshot &older, const PackageSnapshot &newer)
+{
+    QList<Change> ret;
+    diff(older, newer, [&ret] (const Change &change) {
+        ret.append(change);
+    });
+    return ret;
+}
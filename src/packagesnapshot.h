@@ -0,0 +1,137 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_PACKAGE_SNAPSHOT_H
+#define PACKAGEKIT_PACKAGE_SNAPSHOT_H
+
+#include <QtCore/QList>
+#include <QtCore/QSharedDataPointer>
+#include <QtCore/QString>
+
+#include <functional>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+#include "versioncompare.h"
+
+namespace PackageKit {
+
+/**
+ * \class PackageSnapshot packagesnapshot.h PackageSnapshot
+ *
+ * \brief A set of packages taken at one point in time, e.g. the result of Daemon::getPackages()
+ *
+ * Packages are stored column by column together with a precomputed hash of
+ * their (name, arch) pair and a version sort key, so that two snapshots
+ * can be compared with diff() in a single linear pass.
+ *
+ * This class is implicitly shared.
+ */
+class PackageSnapshotPrivate;
+class PACKAGEKITQT_LIBRARY PackageSnapshot
+{
+public:
+    /**
+     * Describes how a package changed between two snapshots
+     */
+    enum ChangeKind {
+        Added,
+        Removed,
+        Upgraded,
+        Downgraded
+    };
+
+    /**
+     * A single difference found by diff()
+     *
+     * \li \c oldPackageId is empty for added packages
+     * \li \c newPackageId is empty for removed packages
+     * \li \c info and \c summary come from the newer snapshot, or the older one for removed packages
+     */
+    struct Change {
+        ChangeKind kind;
+        QString oldPackageId;
+        QString newPackageId;
+        Transaction::Info info;
+        QString summary;
+    };
+
+    typedef std::function<void(const Change &change)> ChangeCallback;
+
+    /**
+     * Creates an empty snapshot whose versions are ordered using \p scheme
+     */
+    explicit PackageSnapshot(VersionCompare::Scheme scheme = VersionCompare::SchemeRpm);
+    PackageSnapshot(const PackageSnapshot &other);
+    ~PackageSnapshot();
+
+    PackageSnapshot &operator=(const PackageSnapshot &other);
+
+    VersionCompare::Scheme scheme() const;
+
+    void reserve(qsizetype size);
+
+    /**
+     * Adds a package, the arguments match the Transaction::package() signal
+     * so it can be used directly from a slot connected to it
+     */
+    void append(Transaction::Info info, const QString &packageID, const QString &summary);
+
+    qsizetype size() const;
+    bool isEmpty() const;
+    void clear();
+
+    QString packageId(qsizetype row) const;
+    Transaction::Info info(qsizetype row) const;
+    QString summary(qsizetype row) const;
+
+    /**
+     * Sorts the snapshot by (name, arch) hash and version
+     *
+     * diff() sorts on its own when needed, calling this first avoids
+     * sorting a temporary copy each time the same snapshot is compared.
+     */
+    void sort();
+
+    bool isSorted() const;
+
+    /**
+     * Compares \p older with \p newer and calls \p callback for every
+     * package that was added, removed, upgraded or downgraded, in (name, arch)
+     * hash order.
+     *
+     * Packages are identified by name and arch, the same version of
+     * a package coming from a different repository is not a change.
+     */
+    static void diff(const PackageSnapshot &older, const PackageSnapshot &newer, const ChangeCallback &callback);
+
+    /**
+     * Convenience overload returning all changes at once
+     */
+    static QList<Change> diff(const PackageSnapshot &older, const PackageSnapshot &newer);
+
+private:
+    QSharedDataPointer<PackageSnapshotPrivate> d;
+};
+
+} // End namespace PackageKit
+
+#endif
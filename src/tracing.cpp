@@ -0,0 +1,204 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "tracing.h"
+#include "tracingprivate.h"
+
+#ifdef PACKAGEKITQT_TRACING
+
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QMutex>
+#include <QThread>
+
+Q_DECLARE_LOGGING_CATEGORY(PACKAGEKITQT_DAEMON)
+
+namespace PackageKit {
+
+namespace TracingPrivate {
+
+std::atomic<bool> active(false);
+
+// Written out once this much is buffered
+constexpr int FlushSize = 256 * 1024;
+
+static QMutex s_mutex;
+static QFile *s_file = nullptr;
+static QByteArray s_buffer;
+static bool s_postRoutineAdded = false;
+
+qint64 now()
+{
+    return QDeadlineTimer::current(Qt::PreciseTimer).deadlineNSecs() / 1000;
+}
+
+static void flush()
+{
+    s_file->write(s_buffer);
+    s_file->flush();
+    s_buffer.clear();
+}
+
+static void append(QJsonObject &&object)
+{
+    const QByteArray json = QJsonDocument(object).toJson(QJsonDocument::Compact);
+
+    QMutexLocker locker(&s_mutex);
+    if (!s_file) {
+        return;
+    }
+    s_buffer += ",\n" + json;
+    if (s_buffer.size() > FlushSize) {
+        flush();
+    }
+}
+
+static QJsonObject makeEvent(char phase, const char *name, qint64 timestamp, qint64 duration, const void *id)
+{
+    QJsonObject object{
+        { QStringLiteral("name"), QLatin1String(name) },
+        { QStringLiteral("cat"), QStringLiteral("packagekitqt") },
+        { QStringLiteral("ph"), QString(QLatin1Char(phase)) },
+        { QStringLiteral("ts"), timestamp },
+        { QStringLiteral("pid"), QCoreApplication::applicationPid() },
+        { QStringLiteral("tid"), qint64(quintptr(QThread::currentThreadId())) },
+    };
+    if (phase == 'X') {
+        object.insert(QStringLiteral("dur"), duration);
+    } else if (phase == 'i') {
+        object.insert(QStringLiteral("s"), QStringLiteral("t"));
+    }
+    if (id) {
+        object.insert(QStringLiteral("id"), QString(QLatin1String("0x") + QString::number(quintptr(id), 16)));
+    }
+    return object;
+}
+
+void event(char phase, const char *name, qint64 timestamp, qint64 duration, const void *id,
+           const char *argName, qint64 argValue)
+{
+    QJsonObject object = makeEvent(phase, name, timestamp, duration, id);
+    if (argName) {
+        object.insert(QStringLiteral("args"), QJsonObject{ { QLatin1String(argName), argValue } });
+    }
+    append(std::move(object));
+}
+
+void event(char phase, const char *name, qint64 timestamp, qint64 duration, const void *id,
+           const char *argName, const QString &argValue)
+{
+    QJsonObject object = makeEvent(phase, name, timestamp, duration, id);
+    if (argName) {
+        object.insert(QStringLiteral("args"), QJsonObject{ { QLatin1String(argName), argValue } });
+    }
+    append(std::move(object));
+}
+
+}
+
+}
+
+using namespace PackageKit;
+
+bool Tracing::isAvailable()
+{
+    return true;
+}
+
+bool Tracing::start(const QString &fileName)
+{
+    using namespace TracingPrivate;
+
+    stop();
+
+    auto file = new QFile(fileName);
+    if (!file->open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(PACKAGEKITQT_DAEMON) << "Failed to write trace events to" << fileName << file->errorString();
+        delete file;
+        return false;
+    }
+
+    {
+        QMutexLocker locker(&s_mutex);
+        s_file = file;
+        // The array format lets every event be appended with a leading comma
+        QJsonObject processName = makeEvent('M', "process_name", 0, 0, nullptr);
+        processName.insert(QStringLiteral("args"),
+                           QJsonObject{ { QStringLiteral("name"), QCoreApplication::applicationName() } });
+        s_buffer = "[\n" + QJsonDocument(processName).toJson(QJsonDocument::Compact);
+        if (!s_postRoutineAdded) {
+            qAddPostRoutine(Tracing::stop);
+            s_postRoutineAdded = true;
+        }
+    }
+    active.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void Tracing::stop()
+{
+    using namespace TracingPrivate;
+
+    active.store(false, std::memory_order_relaxed);
+
+    QMutexLocker locker(&s_mutex);
+    if (!s_file) {
+        return;
+    }
+    s_buffer += "\n]\n";
+    flush();
+    delete s_file;
+    s_file = nullptr;
+}
+
+bool Tracing::isActive()
+{
+    return TracingPrivate::isActive();
+}
+
+#else
+
+using namespace PackageKit;
+
+bool Tracing::isAvailable()
+{
+    return false;
+}
+
+bool Tracing::start(const QString &fileName)
+{
+    Q_UNUSED(fileName)
+    return false;
+}
+
+void Tracing::stop()
+{
+}
+
+bool Tracing::isActive()
+{
+    return false;
+}
+
+#endif
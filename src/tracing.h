@@ -0,0 +1,70 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRACING_H
+#define PACKAGEKIT_TRACING_H
+
+#include <QtCore/QString>
+
+#include <packagekitqt_global.h>
+
+namespace PackageKit {
+
+/**
+ * \class Tracing tracing.h Tracing
+ *
+ * \brief Writes what transactions do to a trace-event file
+ *
+ * The file uses the JSON trace-event format understood by
+ * chrome://tracing, Perfetto UI and speedscope. It shows transaction
+ * lifetimes, the role method calls, property updates and package
+ * batches with the number of items each carried.
+ *
+ * Timestamps are taken on the monotonic clock, in microseconds, so the
+ * events line up with application spans recorded on the same clock.
+ *
+ * Tracing must be enabled at build time with the TRACING CMake option,
+ * otherwise start() does nothing. Setting PACKAGEKITQT_TRACE_FILE in the
+ * environment starts it when Daemon::global() is first used.
+ */
+class PACKAGEKITQT_LIBRARY Tracing
+{
+public:
+    /**
+     * Returns true if the library was built with tracing support
+     */
+    static bool isAvailable();
+
+    /**
+     * Starts writing events to \p fileName, replacing its content
+     *
+     * Events are buffered, the file is complete once stop() was called,
+     * which happens automatically when the application object is destroyed.
+     */
+    static bool start(const QString &fileName);
+
+    static void stop();
+
+    static bool isActive();
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRACING_PRIVATE_H
+#define PACKAGEKIT_TRACING_PRIVATE_H
+
+#include <QtCore/QString>
+
+#ifdef PACKAGEKITQT_TRACING
+
+#include <atomic>
+
+namespace PackageKit {
+
+namespace TracingPrivate {
+
+extern std::atomic<bool> active;
+
+inline bool isActive()
+{
+    return active.load(std::memory_order_relaxed);
+}
+
+qint64 now();
+
+// Phases of the trace-event format, see the "ph" field
+void event(char phase, const char *name, qint64 timestamp, qint64 duration, const void *id,
+           const char *argName, qint64 argValue);
+void event(char phase, const char *name, qint64 timestamp, qint64 duration, const void *id,
+           const char *argName, const QString &argValue);
+
+// Records the time spent in the enclosing block as a complete event
+class Scope
+{
+public:
+    explicit Scope(const char *name)
+        : m_name(name)
+        , m_start(isActive() ? now() : -1)
+    {
+    }
+
+    ~Scope()
+    {
+        if (m_start >= 0) {
+            event('X', m_name, m_start, now() - m_start, nullptr, m_argName, m_argValue);
+        }
+    }
+
+    void setArg(const char *name, qint64 value)
+    {
+        m_argName = name;
+        m_argValue = value;
+    }
+
+private:
+    const char *m_name;
+    qint64 m_start;
+    const char *m_argName = nullptr;
+    qint64 m_argValue = 0;
+};
+
+}
+
+} // End namespace PackageKit
+
+// The scope is named by the caller, so several can live in one block
+#define PK_TRACE_SCOPE(scope, name) \
+    PackageKit::TracingPrivate::Scope scope(name)
+#define PK_TRACE_SCOPE_ARG(scope, argName, argValue) \
+    scope.setArg(argName, argValue)
+#define PK_TRACE_INSTANT(name, argName, argValue) \
+    do { \
+        if (PackageKit::TracingPrivate::isActive()) \
+            PackageKit::TracingPrivate::event('i', name, PackageKit::TracingPrivate::now(), 0, nullptr, argName, argValue); \
+    } while (false)
+#define PK_TRACE_BEGIN(name, id, argName, argValue) \
+    do { \
+        if (PackageKit::TracingPrivate::isActive()) \
+            PackageKit::TracingPrivate::event('b', name, PackageKit::TracingPrivate::now(), 0, id, argName, argValue); \
+    } while (false)
+#define PK_TRACE_END(name, id, argName, argValue) \
+    do { \
+        if (PackageKit::TracingPrivate::isActive()) \
+            PackageKit::TracingPrivate::event('e', name, PackageKit::TracingPrivate::now(), 0, id, argName, argValue); \
+    } while (false)
+
+#else
+
+#define PK_TRACE_SCOPE(scope, name) do { } while (false)
+#define PK_TRACE_SCOPE_ARG(scope, argName, argValue) do { } while (false)
+#define PK_TRACE_INSTANT(name, argName, argValue) do { } while (false)
+#define PK_TRACE_BEGIN(name, id, argName, argValue) do { } while (false)
+#define PK_TRACE_END(name, id, argName, argValue) do { } while (false)
+
+#endif
+
+#endif
@@ -24,14 +24,25 @@
 #include "transactionproxy.h"
 
 #include "daemon.h"
+#include "daemonprivate.h"
 #include "common.h"
+#include "metricsprivate.h"
+#include "transactiondecoder.h"
+#include "transactionprogressprivate.h"
+#include "updatedetail.h"
 
 #include <QDBusError>
+#include <QDBusMessage>
+#include <QMutex>
 
 Q_LOGGING_CATEGORY(PACKAGEKITQT_TRANSACTION, "packagekitqt.transaction")
 
 using namespace PackageKit;
 
+// Transactions may be deleted on any thread
+static QBasicMutex s_timingsObserverMutex;
+static Transaction::TimingsObserver s_timingsObserver;
+
 Transaction::Transaction()
     : d_ptr(new TransactionPrivate(this))
 {
@@ -39,7 +50,14 @@ Transaction::Transaction()
 
     connect(Daemon::global(), SIGNAL(daemonQuit()), SLOT(daemonQuit()));
 
-    QDBusPendingReply<QDBusObjectPath> reply = Daemon::global()->createTransaction();
+    // Not through the Daemon's proxy, which belongs to the main thread
+    d->connection = DaemonPrivate::threadConnection();
+    QDBusMessage message = QDBusMessage::createMethodCall(PK_NAME,
+                                                          PK_PATH,
+                                                          PK_NAME,
+                                                          QLatin1String("CreateTransaction"));
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    QDBusPendingReply<QDBusObjectPath> reply = d->connection.asyncCall(message);
     auto watcher = new QDBusPendingCallWatcher(reply, this);
     connect(watcher, &QDBusPendingCallWatcher::finished,
             this, [this, d] (QDBusPendingCallWatcher *call)
@@ -53,6 +71,8 @@ Transaction::Transaction()
             d->finished(Transaction::ExitFailed, 0);
             d->destroy();
         } else {
+            d->timings.mark(TransactionTimings::PhaseCreated);
+
             // Setup our new Transaction ID
             d->setup(reply.argumentAt<0>());
         }
@@ -66,6 +86,7 @@ Transaction::Transaction(const QDBusObjectPath &tid)
     Q_D(Transaction);
 
     connect(Daemon::global(), SIGNAL(daemonQuit()), SLOT(daemonQuit()));
+    d->connection = DaemonPrivate::threadConnection();
     d->setup(tid);
 }
 
@@ -102,25 +123,56 @@ void TransactionPrivate::setupSignal(const QMetaMethod &signal)
         signalToConnect = SIGNAL(Category(QString,QString,QString,QString,QString));
         memberToConnect = SIGNAL(category(QString,QString,QString,QString,QString));
     } else if (signal == QMetaMethod::fromSignal(&Transaction::details)) {
-        signalToConnect = SIGNAL(Details(QVariantMap));
-        memberToConnect = SLOT(details(QVariantMap));
+        // Once packageDetails() is connected, its slot emits this one too
+        if (!packageDetailsConnected) {
+            signalToConnect = SIGNAL(Details(QVariantMap));
+            memberToConnect = SLOT(details(QVariantMap));
+        }
+    } else if (signal == QMetaMethod::fromSignal(&Transaction::packageDetails)) {
+        // Decoded without a QVariantMap, and only once for both signals
+        packageDetailsConnected = true;
+        QObject::disconnect(p, SIGNAL(Details(QVariantMap)), q, nullptr);
+        if (!p->connection().connect(p->service(), p->path(), p->interface(), QStringLiteral("Details"),
+                                     q, SLOT(Details(PackageKit::PackageDetails)))) {
+            qWarning() << "Failed to connect Details";
+        }
     } else if (signal == QMetaMethod::fromSignal(&Transaction::distroUpgrade)) {
         signalToConnect = SIGNAL(DistroUpgrade(uint,QString,QString));
         memberToConnect = SLOT(distroUpgrade(uint,QString,QString));
     } else if (signal == QMetaMethod::fromSignal(&Transaction::errorCode)) {
         signalToConnect = SIGNAL(ErrorCode(uint,QString));
         memberToConnect = SLOT(errorCode(uint,QString));
-    } else if (signal == QMetaMethod::fromSignal(&Transaction::files)) {
-        signalToConnect = SIGNAL(Files(QString,QStringList));
-        memberToConnect = SIGNAL(files(QString,QStringList));
+    } else if (signal == QMetaMethod::fromSignal(&Transaction::files)
+               || signal == QMetaMethod::fromSignal(&Transaction::fileList)) {
+        // Both are fed by the same D-Bus signals
+        if (!filesConnected) {
+            filesConnected = true;
+            signalToConnect = SIGNAL(Files(QString,QStringList));
+            memberToConnect = SLOT(Files(QString,QStringList));
+
+            // Speculative, PackageKit itself only sends Files
+            if (!p->connection().connect(p->service(), p->path(), p->interface(), QStringLiteral("FileLists"),
+                                         decoder ? static_cast<QObject *>(decoder) : q, SLOT(FileLists(PackageKit::FileList)))) {
+                qWarning() << "Failed to connect FileLists";
+            }
+        }
     } else if (signal == QMetaMethod::fromSignal(&Transaction::finished)) {
-        signalToConnect = SIGNAL(Finished(uint,uint));
-        memberToConnect = SLOT(finished(uint,uint));
+        if (decoder) {
+            // Must not overtake results still on the decoding thread
+            if (!p->connection().connect(p->service(), p->path(), p->interface(), QStringLiteral("Finished"),
+                                         decoder, SLOT(Finished(uint,uint)))) {
+                qWarning() << "Failed to connect Finished";
+            }
+        } else {
+            signalToConnect = SIGNAL(Finished(uint,uint));
+            memberToConnect = SLOT(finished(uint,uint));
+        }
     } else if (signal == QMetaMethod::fromSignal(&Transaction::package)) {
         signalToConnect = SIGNAL(Package(uint,QString,QString));
         memberToConnect = SLOT(Package(uint,QString,QString));
 
-        if (!p->connection().connect(p->service(), p->path(), p->interface(), QStringLiteral("Packages"), q, SLOT(Packages(QList<PackageKit::PkPackage>)))) {
+        if (!p->connection().connect(p->service(), p->path(), p->interface(), QStringLiteral("Packages"),
+                                     decoder ? static_cast<QObject *>(decoder) : q, SLOT(Packages(QList<PackageKit::PkPackage>)))) {
             qWarning() << "Failed to connect Packages";
         }
     } else if (signal == QMetaMethod::fromSignal(&Transaction::repoDetail)) {
@@ -144,24 +196,50 @@ void TransactionPrivate::setupSignal(const QMetaMethod &signal)
     } else if (signal == QMetaMethod::fromSignal(&Transaction::transaction)) {
         signalToConnect = SIGNAL(Transaction(QDBusObjectPath,QString,bool,uint,uint,QString,uint,QString));
         memberToConnect = SLOT(transaction(QDBusObjectPath,QString,bool,uint,uint,QString,uint,QString));
-    } else if (signal == QMetaMethod::fromSignal(&Transaction::updateDetail)) {
-        signalToConnect = SIGNAL(UpdateDetail(QString,QStringList,QStringList,QStringList,QStringList,QStringList,uint,QString,QString,uint,QString,QString));
-        memberToConnect = SLOT(UpdateDetail(QString,QStringList,QStringList,QStringList,QStringList,QStringList,uint,QString,QString,uint,QString,QString));
-
-        if (!p->connection().connect(p->service(), p->path(), p->interface(), QStringLiteral("UpdateDetails"), q, SLOT(UpdateDetails(QList<PackageKit::PkDetail>)))) {
-            qWarning() << "Failed to connect UpdateDetails";
+    } else if (signal == QMetaMethod::fromSignal(&Transaction::transactionRecords)) {
+        signalToConnect = SIGNAL(Transaction(QDBusObjectPath,QString,bool,uint,uint,QString,uint,QString));
+        memberToConnect = SLOT(transactionRecord(QDBusObjectPath,QString,bool,uint,uint,QString,uint,QString));
+    } else if (signal == QMetaMethod::fromSignal(&Transaction::updateDetail)
+               || signal == QMetaMethod::fromSignal(&Transaction::updateDetails)) {
+        // Both are fed by the same D-Bus signals
+        if (!updateDetailsConnected) {
+            updateDetailsConnected = true;
+            signalToConnect = SIGNAL(UpdateDetail(QString,QStringList,QStringList,QStringList,QStringList,QStringList,uint,QString,QString,uint,QString,QString));
+            memberToConnect = SLOT(UpdateDetail(QString,QStringList,QStringList,QStringList,QStringList,QStringList,uint,QString,QString,uint,QString,QString));
+
+            if (!p->connection().connect(p->service(), p->path(), p->interface(), QStringLiteral("UpdateDetails"),
+                                         decoder ? static_cast<QObject *>(decoder) : q, SLOT(UpdateDetails(QList<PackageKit::PkDetail>)))) {
+                qWarning() << "Failed to connect UpdateDetails";
+            }
         }
     }
 
     if (signalToConnect && memberToConnect) {
         bool b = QObject::connect(p, signalToConnect, q, memberToConnect);
         Q_ASSERT(b);
+
+        if (MetricsPrivate::isEnabled()) {
+            QObject::connect(p, signalToConnect, q, SLOT(signalReceived()));
+        }
     }
 }
 
 Transaction::~Transaction()
 {
 //    qDebug() << "Destroying transaction with tid" << d_ptr->tid.path();
+    TransactionTimings &timings = d_ptr->timings;
+    timings.mark(TransactionTimings::PhaseDestroyed);
+    if (timings.hasPhase(TransactionTimings::PhaseSetUp) || timings.hasPhase(TransactionTimings::PhaseFinished)) {
+        // Called without the lock, the observer may replace itself
+        Transaction::TimingsObserver observer;
+        {
+            QMutexLocker locker(&s_timingsObserverMutex);
+            observer = s_timingsObserver;
+        }
+        if (observer) {
+            observer(this, timings);
+        }
+    }
     delete d_ptr;
 }
 
@@ -187,6 +265,7 @@ QDBusPendingReply<> Transaction::cancel()
 {
     Q_D(const Transaction);
     if (d->p) {
+        MetricsPrivate::add(MetricsPrivate::MethodCalls);
         return d->p->Cancel();
     }
     return QDBusPendingReply<>();
@@ -255,6 +334,30 @@ QString Transaction::packageData(const QString &packageID)
     return ret;
 }
 
+TransactionProgress Transaction::progress() const
+{
+    Q_D(const Transaction);
+    if (!d->progress) {
+        d->progress = std::make_shared<TransactionProgressPrivate>();
+        d->publishProgress(d->sentFinished);
+    }
+    return TransactionProgress(d->progress);
+}
+
+TransactionTimings Transaction::timings() const
+{
+    Q_D(const Transaction);
+    return d->timings;
+}
+
+void Transaction::setTimingsObserver(const TimingsObserver &observer)
+{
+    // Destroy the old one outside of the lock
+    TimingsObserver old = observer;
+    QMutexLocker locker(&s_timingsObserverMutex);
+    s_timingsObserver.swap(old);
+}
+
 QString Transaction::lastPackage() const
 {
     Q_D(const Transaction);
@@ -302,6 +405,7 @@ QDBusPendingReply<> Transaction::setHints(const QStringList &hints)
     Q_D(Transaction);
     d->hints = hints;
     if (d->p) {
+        MetricsPrivate::add(MetricsPrivate::MethodCalls);
         return d->p->SetHints(hints);
     }
     return QDBusPendingReply<>();
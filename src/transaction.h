@@ -30,10 +30,18 @@
 #include <packagekitqt_global.h>
 
 #include "bitfield.h"
+#include "transactiontimings.h"
+
+#include <functional>
 
 namespace PackageKit {
 
 class Details;
+class FileList;
+class PackageDetails;
+class TransactionProgress;
+class TransactionRecord;
+class UpdateDetail;
 struct PkPackage;
 struct PkDetail;
 
@@ -564,6 +572,16 @@ public:
      */
     qulonglong downloadSizeRemaining() const;
 
+    /**
+     * \brief Returns a reader for the progress of this transaction usable from any thread
+     *
+     * status(), percentage() and the other progress accessors may only be
+     * used on the thread of the transaction. Copies of the returned object
+     * can be read by other threads without locking, even after the
+     * transaction is gone. Call this on the thread of the transaction.
+     */
+    TransactionProgress progress() const;
+
     /**
      * Returns information describing the transaction
      * like InstallPackages, SearchName or GetUpdates
@@ -688,6 +706,30 @@ public:
      */
     static QString packageData(const QString &packageID);
 
+    /**
+     * Returns when this transaction went through each phase so far
+     * \sa setTimingsObserver()
+     */
+    TransactionTimings timings() const;
+
+    typedef std::function<void(const Transaction *transaction, const TransactionTimings &timings)> TimingsObserver;
+
+    /**
+     * \brief Sets a function called with the timings of each transaction when it is deleted
+     *
+     * The \p observer gets the transactions this process ran or watched,
+     * not the old ones sent by transaction(). It is called from
+     * ~Transaction(), so only the accessors of the transaction can be
+     * used. Pass an empty function to remove it.
+     *
+     * Can be called from any thread, the observer is called on the
+     * thread deleting the transaction and may still be called once
+     * shortly after being replaced.
+     *
+     * \sa timings()
+     */
+    static void setTimingsObserver(const TimingsObserver &observer);
+
 Q_SIGNALS:
     void allowCancelChanged();
 
@@ -771,6 +813,21 @@ Q_SIGNALS:
      */
     void files(const QString &packageID, const QStringList &filenames);
 
+    /**
+     * Sends the files of packages in batches
+     * \sa getFiles(), FileList
+     *
+     * This is a cheaper alternative to files() for long lists, the paths
+     * are kept in the compact form of FileList. All files received are
+     * delivered before finished()
+     *
+     * \note PackageKit daemons always send the singular Files signal,
+     * whose results are batched here. A plural FileLists signal, decoded
+     * straight into FileList, is handled as well but is speculative, no
+     * released daemon emits it.
+     */
+    void fileList(const PackageKit::FileList &files);
+
     /**
      * Emitted when the transaction finishes
      *
@@ -788,6 +845,16 @@ Q_SIGNALS:
      */
     void details(const PackageKit::Details &values);
 
+    /**
+     * Sends the details of packages in batches
+     * \sa getDetails(), PackageDetailsList
+     *
+     * This is a cheaper alternative to details(), the entries are filled
+     * from D-Bus without building a QVariantMap for each package.
+     * All details received are delivered before finished()
+     */
+    void packageDetails(const QList<PackageKit::PackageDetails> &details);
+
     /**
      * Emitted when the transaction sends details of an update
      */
@@ -837,6 +904,25 @@ Q_SIGNALS:
      */
     void transaction(PackageKit::Transaction *transaction);
 
+    /**
+     * Sends old transactions in batches
+     * \sa getOldTransactions()
+     *
+     * This is a cheaper alternative to transaction(), no QObject is created
+     * per entry and all records received are delivered before finished()
+     */
+    void transactionRecords(const QList<PackageKit::TransactionRecord> &records);
+
+    /**
+     * Sends the details of updates in batches
+     * \sa getUpdateDetail(), UpdateDetailList
+     *
+     * This is a cheaper alternative to updateDetail(), the entries are
+     * implicitly shared and their dates are only parsed when asked for.
+     * All details received are delivered before finished()
+     */
+    void updateDetails(const QList<PackageKit::UpdateDetail> &details);
+
 protected:
     static Transaction::InternalError parseError(const QString &errorName);
 
@@ -867,22 +953,29 @@ protected:
 
 private:
     friend class Daemon;
+    friend class TransactionRecorder;
+    friend class TransactionReplayer;
     Q_DECLARE_PRIVATE(Transaction)
     Q_DISABLE_COPY(Transaction)
     Q_PRIVATE_SLOT(d_func(), void distroUpgrade(uint type, const QString &name, const QString &description))
     Q_PRIVATE_SLOT(d_func(), void details(const QVariantMap &values))
+    Q_PRIVATE_SLOT(d_func(), void Details(const PackageKit::PackageDetails &details))
     Q_PRIVATE_SLOT(d_func(), void errorCode(uint error, const QString &details))
     Q_PRIVATE_SLOT(d_func(), void mediaChangeRequired(uint mediaType, const QString &mediaId, const QString &mediaText))
     Q_PRIVATE_SLOT(d_func(), void finished(uint exitCode, uint runtime))
+    Q_PRIVATE_SLOT(d_func(), void Files(const QString &packageID, const QStringList &filenames))
+    Q_PRIVATE_SLOT(d_func(), void FileLists(const PackageKit::FileList &files))
     Q_PRIVATE_SLOT(d_func(), void Package(uint info, const QString &pid, const QString &summary))
     Q_PRIVATE_SLOT(d_func(), void Packages(QList<PackageKit::PkPackage>))
     Q_PRIVATE_SLOT(d_func(), void ItemProgress(const QString &itemID, uint status, uint percentage))
     Q_PRIVATE_SLOT(d_func(), void RepoSignatureRequired(const QString &pid, const QString &repoName, const QString &keyUrl, const QString &keyUserid, const QString &keyId, const QString &keyFingerprint, const QString &keyTimestamp, uint type))
     Q_PRIVATE_SLOT(d_func(), void requireRestart(uint type, const QString &pid))
-    Q_PRIVATE_SLOT(d_func(), void transaction(const QDBusObjectPath &oldTid, const QString &timespec, bool succeeded, uint role, uint duration, const QString &data, uint uid, const QString &senderName, const QString &cmdline))
+    Q_PRIVATE_SLOT(d_func(), void transaction(const QDBusObjectPath &oldTid, const QString &timespec, bool succeeded, uint role, uint duration, const QString &data, uint uid, const QString &cmdline))
+    Q_PRIVATE_SLOT(d_func(), void transactionRecord(const QDBusObjectPath &oldTid, const QString &timespec, bool succeeded, uint role, uint duration, const QString &data, uint uid, const QString &cmdline))
     Q_PRIVATE_SLOT(d_func(), void UpdateDetail(const QString &package_id, const QStringList &updates, const QStringList &obsoletes, const QStringList &vendor_urls, const QStringList &bugzilla_urls, const QStringList &cve_urls, uint restart, const QString &update_text, const QString &changelog, uint state, const QString &issued, const QString &updated))
     Q_PRIVATE_SLOT(d_func(), void UpdateDetails(const QList<PackageKit::PkDetail> &dets))
     Q_PRIVATE_SLOT(d_func(), void destroy())
+    Q_PRIVATE_SLOT(d_func(), void signalReceived())
     Q_PRIVATE_SLOT(d_func(), void daemonQuit())
     Q_PRIVATE_SLOT(d_func(), void propertiesChanged(QString,QVariantMap,QStringList))
     Q_PRIVATE_SLOT(d_func(), void updateProperties(QVariantMap))
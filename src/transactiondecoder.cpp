@@ -0,0 +1,108 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactiondecoder.h"
+#include "isodate.h"
+
+#include <QCoreApplication>
+#include <QMutex>
+#include <QThread>
+
+#include <atomic>
+
+using namespace PackageKit;
+
+namespace {
+
+std::atomic<bool> s_enabled = false;
+
+QMutex s_mutex;
+QThread *s_thread = nullptr;
+
+void stopThread()
+{
+    QMutexLocker locker(&s_mutex);
+    if (s_thread) {
+        s_thread->quit();
+        s_thread->wait();
+        delete s_thread;
+        s_thread = nullptr;
+    }
+}
+
+}
+
+void TransactionDecoder::setEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool TransactionDecoder::isEnabled()
+{
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+TransactionDecoder *TransactionDecoder::create()
+{
+    QMutexLocker locker(&s_mutex);
+    if (!s_thread) {
+        s_thread = new QThread;
+        s_thread->setObjectName(QStringLiteral("PackageKit decoder"));
+        s_thread->start();
+        qAddPostRoutine(stopThread);
+    }
+
+    auto decoder = new TransactionDecoder;
+    decoder->moveToThread(s_thread);
+    return decoder;
+}
+
+void TransactionDecoder::Packages(const QList<PkPackage> &packages)
+{
+    Q_EMIT decodedPackages(packages);
+}
+
+void TransactionDecoder::UpdateDetails(const QList<PkDetail> &details)
+{
+    QList<PkDetail> decoded = details;
+    for (PkDetail &detail : decoded) {
+        detail.issuedTime = IsoDate::toDateTime(detail.issued);
+        detail.updatedTime = IsoDate::toDateTime(detail.updated);
+        detail.timesParsed = true;
+    }
+    Q_EMIT decodedUpdateDetails(decoded);
+}
+
+void TransactionDecoder::FileLists(const FileList &files)
+{
+    Q_EMIT decodedFileLists(files);
+}
+
+void TransactionDecoder::Finished(uint exitCode, uint runtime)
+{
+    Q_EMIT decodedFinished(exitCode, runtime);
+}
+
+void TransactionDecoder::Destroy()
+{
+    Q_EMIT decodedDestroy();
+}
+
+#include "moc_transactiondecoder.cpp"
@@ -0,0 +1,74 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_DECODER_H
+#define PACKAGEKIT_TRANSACTION_DECODER_H
+
+#include <QObject>
+
+#include "transactionprivate.h"
+
+namespace PackageKit {
+
+/**
+ * Receives the plural signals of one transaction on the library's
+ * decoding thread, see Daemon::setThreadedDecoding()
+ *
+ * QtDBus demarshals signal arguments on the thread of the receiver, so
+ * by living there the decoder takes that work, and the date parsing of
+ * update details, off the thread owning the Transaction. The finished
+ * batches are re-emitted and reach the transaction through queued
+ * connections. Finished and Destroy take the same route, so they can't
+ * overtake the results still being decoded.
+ */
+class TransactionDecoder : public QObject
+{
+    Q_OBJECT
+public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /**
+     * Returns a new decoder living on the decoding thread, which is
+     * started on first use. Delete it with deleteLater().
+     */
+    static TransactionDecoder *create();
+
+public Q_SLOTS:
+    void Packages(const QList<PackageKit::PkPackage> &packages);
+    void UpdateDetails(const QList<PackageKit::PkDetail> &details);
+    void FileLists(const PackageKit::FileList &files);
+    void Finished(uint exitCode, uint runtime);
+    void Destroy();
+
+Q_SIGNALS:
+    void decodedPackages(const QList<PackageKit::PkPackage> &packages);
+    void decodedUpdateDetails(const QList<PackageKit::PkDetail> &details);
+    void decodedFileLists(const PackageKit::FileList &files);
+    void decodedFinished(uint exitCode, uint runtime);
+    void decodedDestroy();
+
+private:
+    TransactionDecoder() = default;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,323 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactionhistory.h"
+
+#include "daemon.h"
+#include "transactionhistoryprivate.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLoggingCategory>
+#include <QSet>
+#include <QStandardPaths>
+
+#include <algorithm>
+#include <utility>
+
+Q_LOGGING_CATEGORY(PACKAGEKITQT_HISTORY, "packagekitqt.history")
+
+namespace PackageKit {
+
+class TransactionHistoryPrivate
+{
+    Q_DECLARE_PUBLIC(TransactionHistory)
+public:
+    TransactionHistoryPrivate(TransactionHistory *parent) : q_ptr(parent) {}
+
+    void load();
+    bool append(const QList<TransactionRecord> &newRecords);
+    void fetch(uint window);
+    void fetched(uint window, Transaction::Exit status);
+    void finish(int newRecords);
+
+    TransactionHistory *q_ptr;
+    QString fileName;
+    QList<TransactionRecord> records;
+    QSet<QString> known;
+    QList<TransactionRecord> received;
+    uint windowSize = 20;
+    bool syncing = false;
+    bool syncQueued = false;
+};
+
+}
+
+using namespace PackageKit;
+
+namespace {
+
+// "PKTH", followed by the format version
+constexpr quint32 HistoryMagic = 0x504b5448;
+constexpr quint32 HistoryVersion = 1;
+
+// PackageKit keeps its history in a database, there is no point
+// in asking for more than that in a single request
+constexpr uint MaxWindowSize = 1u << 20;
+
+}
+
+TransactionHistory::TransactionHistory(QObject *parent)
+    : TransactionHistory(defaultFileName(), parent)
+{
+}
+
+TransactionHistory::TransactionHistory(const QString &fileName, QObject *parent)
+    : QObject(parent)
+    , d_ptr(new TransactionHistoryPrivate(this))
+{
+    Q_D(TransactionHistory);
+    d->fileName = fileName;
+    d->load();
+}
+
+TransactionHistory::~TransactionHistory()
+{
+    delete d_ptr;
+}
+
+QString TransactionHistory::defaultFileName()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation)
+            + QLatin1String("/packagekitqt-history");
+}
+
+QString TransactionHistory::fileName() const
+{
+    Q_D(const TransactionHistory);
+    return d->fileName;
+}
+
+QList<TransactionRecord> TransactionHistory::records() const
+{
+    Q_D(const TransactionHistory);
+    return d->records;
+}
+
+int TransactionHistory::count() const
+{
+    Q_D(const TransactionHistory);
+    return d->records.size();
+}
+
+bool TransactionHistory::contains(const TransactionRecord &record) const
+{
+    Q_D(const TransactionHistory);
+    return d->known.contains(historyKey(record));
+}
+
+bool TransactionHistory::isSyncing() const
+{
+    Q_D(const TransactionHistory);
+    return d->syncing;
+}
+
+uint TransactionHistory::windowSize() const
+{
+    Q_D(const TransactionHistory);
+    return d->windowSize;
+}
+
+void TransactionHistory::setWindowSize(uint size)
+{
+    Q_D(TransactionHistory);
+    d->windowSize = qBound(1u, size, MaxWindowSize);
+}
+
+void TransactionHistory::sync()
+{
+    Q_D(TransactionHistory);
+    if (d->syncing) {
+        d->syncQueued = true;
+        return;
+    }
+
+    d->syncing = true;
+    Q_EMIT syncingChanged();
+    d->fetch(d->windowSize);
+}
+
+void TransactionHistoryPrivate::load()
+{
+    QFile file(fileName);
+    if (!file.exists()) {
+        return;
+    }
+    if (!file.open(QIODevice::ReadWrite)) {
+        qCWarning(PACKAGEKITQT_HISTORY) << "Failed to open" << fileName << file.errorString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (stream.status() != QDataStream::Ok || magic != HistoryMagic || version != HistoryVersion) {
+        // Also a file cut short right after it was created, append()
+        // only writes the header into an empty file
+        qCWarning(PACKAGEKITQT_HISTORY) << "Resetting unknown history file" << fileName;
+        if (!file.resize(0)) {
+            qCWarning(PACKAGEKITQT_HISTORY) << "Failed to reset" << fileName << file.errorString();
+        }
+        return;
+    }
+
+    qint64 lastGood = file.pos();
+    while (!stream.atEnd()) {
+        QString tid;
+        QString timespec;
+        bool succeeded;
+        quint32 role;
+        quint32 duration;
+        QString data;
+        quint32 uid;
+        QString cmdline;
+        stream >> tid >> timespec >> succeeded >> role >> duration >> data >> uid >> cmdline;
+        if (stream.status() != QDataStream::Ok) {
+            break;
+        }
+
+        TransactionRecord record(QDBusObjectPath(tid),
+                                 timespec,
+                                 succeeded,
+                                 static_cast<Transaction::Role>(role),
+                                 duration,
+                                 data,
+                                 uid,
+                                 cmdline);
+        known.insert(historyKey(record));
+        records.append(record);
+        lastGood = file.pos();
+    }
+
+    // Drop a partially written entry so new ones can be appended
+    if (lastGood != file.size()) {
+        qCWarning(PACKAGEKITQT_HISTORY) << "Truncating damaged history file" << fileName << "at" << lastGood;
+        file.resize(lastGood);
+    }
+}
+
+bool TransactionHistoryPrivate::append(const QList<TransactionRecord> &newRecords)
+{
+    QDir().mkpath(QFileInfo(fileName).absolutePath());
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(PACKAGEKITQT_HISTORY) << "Failed to open" << fileName << file.errorString();
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    if (file.size() == 0) {
+        stream << HistoryMagic << HistoryVersion;
+    }
+
+    for (const TransactionRecord &record : newRecords) {
+        stream << record.tid().path()
+               << record.timespecString()
+               << record.succeeded()
+               << quint32(record.role())
+               << quint32(record.duration())
+               << record.data()
+               << quint32(record.uid())
+               << record.cmdline();
+    }
+    return stream.status() == QDataStream::Ok && file.flush();
+}
+
+void TransactionHistoryPrivate::fetch(uint window)
+{
+    Q_Q(TransactionHistory);
+
+    received.clear();
+    Transaction *transaction = Daemon::getOldTransactions(window);
+    q->connect(transaction, &Transaction::transactionRecords,
+               q, [this] (const QList<TransactionRecord> &batch) {
+        received.append(batch);
+    });
+    q->connect(transaction, &Transaction::errorCode, q, &TransactionHistory::errorCode);
+    q->connect(transaction, &Transaction::finished, q, [this, window] (Transaction::Exit status) {
+        fetched(window, status);
+    });
+}
+
+void TransactionHistoryPrivate::fetched(uint window, Transaction::Exit status)
+{
+    if (status != Transaction::ExitSuccess) {
+        received.clear();
+        finish(0);
+        return;
+    }
+
+    // The daemon sends the newest entries first, everything
+    // past the first one we already have is known as well
+    QList<TransactionRecord> newRecords;
+    bool reachedKnown = false;
+    for (const TransactionRecord &record : std::as_const(received)) {
+        if (known.contains(historyKey(record))) {
+            reachedKnown = true;
+            break;
+        }
+        newRecords.append(record);
+    }
+
+    if (!reachedKnown && uint(received.size()) >= window && window < MaxWindowSize) {
+        // The window did not reach back to what we have, there may be more
+        fetch(qMin(window * 2, MaxWindowSize));
+        return;
+    }
+    received.clear();
+
+    std::reverse(newRecords.begin(), newRecords.end());
+    if (!newRecords.isEmpty()) {
+        if (!append(newRecords)) {
+            qCWarning(PACKAGEKITQT_HISTORY) << "Failed to store" << newRecords.size() << "history entries";
+        }
+        for (const TransactionRecord &record : std::as_const(newRecords)) {
+            known.insert(historyKey(record));
+        }
+        records.append(newRecords);
+
+        Q_Q(TransactionHistory);
+        Q_EMIT q->recordsAdded(newRecords);
+    }
+    finish(newRecords.size());
+}
+
+void TransactionHistoryPrivate::finish(int newRecords)
+{
+    Q_Q(TransactionHistory);
+
+    syncing = false;
+    Q_EMIT q->syncingChanged();
+    Q_EMIT q->synced(newRecords);
+
+    if (syncQueued) {
+        syncQueued = false;
+        q->sync();
+    }
+}
+
+#include "moc_transactionhistory.cpp"
@@ -0,0 +1,117 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_HISTORY_H
+#define PACKAGEKIT_TRANSACTION_HISTORY_H
+
+#include <QtCore/QObject>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+#include "transactionrecord.h"
+
+namespace PackageKit {
+
+/**
+ * \class TransactionHistory transactionhistory.h TransactionHistory
+ *
+ * \brief A local copy of the daemon's transaction history
+ *
+ * Daemon::getOldTransactions() can only return the last N transactions, so
+ * keeping a full history means fetching and parsing all of it each time.
+ * This class keeps every entry it has seen in an append-only file and on
+ * sync() only asks the daemon for a small window of recent entries,
+ * growing it only while no already known entry shows up.
+ *
+ * Entries are identified by their TID and timespec. The records are
+ * available right after construction, even when the daemon is not running.
+ */
+class TransactionHistoryPrivate;
+class PACKAGEKITQT_LIBRARY TransactionHistory : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool syncing READ isSyncing NOTIFY syncingChanged)
+public:
+    /**
+     * Opens the history stored at defaultFileName()
+     */
+    explicit TransactionHistory(QObject *parent = nullptr);
+
+    /**
+     * Opens the history stored at \p fileName, the file is created on first sync
+     */
+    explicit TransactionHistory(const QString &fileName, QObject *parent = nullptr);
+    ~TransactionHistory() override;
+
+    /**
+     * Returns the default location of the history file, inside the
+     * application's local data directory
+     */
+    static QString defaultFileName();
+
+    QString fileName() const;
+
+    /**
+     * Returns all known entries, oldest first
+     */
+    QList<TransactionRecord> records() const;
+
+    int count() const;
+
+    bool contains(const TransactionRecord &record) const;
+
+    bool isSyncing() const;
+
+    /**
+     * The number of entries asked for in the first request of a sync, defaults to 20
+     */
+    uint windowSize() const;
+    void setWindowSize(uint size);
+
+public Q_SLOTS:
+    /**
+     * Fetches the entries added since the last sync
+     */
+    void sync();
+
+Q_SIGNALS:
+    /**
+     * Emitted with the entries a sync found, oldest first
+     */
+    void recordsAdded(const QList<PackageKit::TransactionRecord> &records);
+
+    /**
+     * Emitted when a sync is done, \p newRecords may be 0
+     */
+    void synced(int newRecords);
+
+    void errorCode(PackageKit::Transaction::Error error, const QString &details);
+
+    void syncingChanged();
+
+private:
+    Q_DECLARE_PRIVATE(TransactionHistory)
+    TransactionHistoryPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
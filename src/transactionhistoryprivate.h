@@ -0,0 +1,39 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_HISTORY_PRIVATE_H
+#define PACKAGEKIT_TRANSACTION_HISTORY_PRIVATE_H
+
+#include "transactionrecord.h"
+
+namespace PackageKit {
+
+/**
+ * Identifies an entry of the daemon's history, TIDs alone are reused
+ * after a reboot so the timespec is part of it
+ */
+inline QString historyKey(const TransactionRecord &record)
+{
+    return record.tid().path() + QLatin1Char('\n') + record.timespecString();
+}
+
+} // End namespace PackageKit
+
+#endif
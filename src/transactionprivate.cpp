@@ -25,6 +25,12 @@
 #include "daemon.h"
 #include "common.h"
 #include "details.h"
+#include "isodate.h"
+#include "metricsprivate.h"
+#include "tracingprivate.h"
+#include "transactiondecoder.h"
+#include "transactionprogressprivate.h"
+#include "transactionrecorderprivate.h"
 
 #include <QStringList>
 
@@ -32,28 +38,63 @@ using namespace PackageKit;
 
 TransactionPrivate::TransactionPrivate(Transaction* parent)
     : q_ptr(parent)
+    , connection(QString())
 {
+    timings.mark(TransactionTimings::PhaseConstructed);
+    MetricsPrivate::transactionCreated();
 }
 
 TransactionPrivate::~TransactionPrivate()
 {
+    if (decoder) {
+        decoder->deleteLater();
+    }
     delete p;
+    MetricsPrivate::transactionDestroyed();
+}
+
+template <typename... Args>
+void TransactionPrivate::record(quint8 event, const Args &...args)
+{
+    if (recorder && recorder->d_ptr->recording) {
+        recorder->d_ptr->record(static_cast<Recording::Event>(event), args...);
+    }
 }
 
 void TransactionPrivate::setup(const QDBusObjectPath &transactionId)
 {
     Q_Q(Transaction);
+    PK_TRACE_BEGIN("Transaction", q, "tid", transactionId.path());
+    PK_TRACE_SCOPE(traceScope, "Transaction::setup");
 
     tid = transactionId;
     p = new OrgFreedesktopPackageKitTransactionInterface(PK_NAME,
                                                          tid.path(),
-                                                         QDBusConnection::systemBus(),
+                                                         connection,
                                                          q);
     QStringList hints = this->hints ? *this->hints : Daemon::global()->hints();
     hints << QStringLiteral("supports-plural-signals=true");
     q->setHints(hints);
 
-    q->connect(p, SIGNAL(Destroy()), SLOT(destroy()));
+    if (TransactionDecoder::isEnabled()) {
+        decoder = TransactionDecoder::create();
+        q->connect(decoder, SIGNAL(decodedPackages(QList<PackageKit::PkPackage>)), SLOT(Packages(QList<PackageKit::PkPackage>)));
+        q->connect(decoder, SIGNAL(decodedUpdateDetails(QList<PackageKit::PkDetail>)), SLOT(UpdateDetails(QList<PackageKit::PkDetail>)));
+        q->connect(decoder, SIGNAL(decodedFileLists(PackageKit::FileList)), SLOT(FileLists(PackageKit::FileList)));
+        q->connect(decoder, SIGNAL(decodedFinished(uint,uint)), SLOT(finished(uint,uint)));
+        q->connect(decoder, SIGNAL(decodedDestroy()), SLOT(destroy()));
+        connection.connect(PK_NAME,
+                           tid.path(),
+                           PK_TRANSACTION_INTERFACE,
+                           QLatin1String("Destroy"),
+                           decoder,
+                           SLOT(Destroy()));
+    } else {
+        q->connect(p, SIGNAL(Destroy()), SLOT(destroy()));
+    }
+    if (MetricsPrivate::isEnabled()) {
+        q->connect(p, SIGNAL(Destroy()), SLOT(signalReceived()));
+    }
 
     // Get current properties
     QDBusMessage message = QDBusMessage::createMethodCall(PK_NAME,
@@ -61,23 +102,26 @@ void TransactionPrivate::setup(const QDBusObjectPath &transactionId)
                                                           DBUS_PROPERTIES,
                                                           QLatin1String("GetAll"));
     message << PK_TRANSACTION_INTERFACE;
-    QDBusConnection::systemBus().callWithCallback(message,
-                                                  q,
-                                                  SLOT(updateProperties(QVariantMap)));
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
+    connection.callWithCallback(message,
+                                q,
+                                SLOT(updateProperties(QVariantMap)));
 
     // Watch for properties updates
-    QDBusConnection::systemBus().connect(PK_NAME,
-                                         tid.path(),
-                                         DBUS_PROPERTIES,
-                                         QLatin1String("PropertiesChanged"),
-                                         q,
-                                         SLOT(propertiesChanged(QString,QVariantMap,QStringList)));
+    connection.connect(PK_NAME,
+                       tid.path(),
+                       DBUS_PROPERTIES,
+                       QLatin1String("PropertiesChanged"),
+                       q,
+                       SLOT(propertiesChanged(QString,QVariantMap,QStringList)));
 
     const QVector<QMetaMethod> signals = connectedSignals;
     for (const QMetaMethod &signal : signals) {
         setupSignal(signal);
     }
 
+    timings.mark(TransactionTimings::PhaseSetUp);
+
     // Execute pending call
     runQueuedTransaction();
 }
@@ -85,6 +129,8 @@ void TransactionPrivate::setup(const QDBusObjectPath &transactionId)
 void TransactionPrivate::runQueuedTransaction()
 {
     Q_Q(Transaction);
+    PK_TRACE_SCOPE(traceScope, "Transaction::runQueuedTransaction");
+    PK_TRACE_SCOPE_ARG(traceScope, "role", role);
 
     QDBusPendingReply<> reply;
     switch (role) {
@@ -187,6 +233,7 @@ void TransactionPrivate::runQueuedTransaction()
     default:
         return;
     }
+    MetricsPrivate::add(MetricsPrivate::MethodCalls);
 
     if (reply.isFinished() && reply.isError()) {
         q->errorCode(Transaction::ErrorInternalError, reply.error().message());
@@ -196,6 +243,8 @@ void TransactionPrivate::runQueuedTransaction()
     auto watcher = new QDBusPendingCallWatcher(reply, q);
     q->connect(watcher, &QDBusPendingCallWatcher::finished,
                q, [this, q] (QDBusPendingCallWatcher *call) {
+        timings.mark(TransactionTimings::PhaseMethodAcknowledged);
+
         QDBusPendingReply<> reply = *call;
         if (reply.isError()) {
             QDBusError error = reply.error();
@@ -212,12 +261,104 @@ void TransactionPrivate::runQueuedTransaction()
 void TransactionPrivate::details(const QVariantMap &values)
 {
     Q_Q(Transaction);
-    q->details(PackageKit::Details(values));
+    record(Recording::EventDetails, values);
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::details))) {
+        q->details(PackageKit::Details(values));
+    }
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::packageDetails))) {
+        appendPackageDetails(PackageKit::PackageDetails(values));
+    }
+}
+
+void TransactionPrivate::Details(const PackageKit::PackageDetails &details)
+{
+    Q_Q(Transaction);
+    MetricsPrivate::add(MetricsPrivate::SignalsReceived);
+
+    // Only connected for packageDetails(), the map is built when
+    // details() or the recorder need it
+    const bool detailsConnected = connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::details));
+    if (recorder || detailsConnected) {
+        const QVariantMap values = details.toVariantMap();
+        record(Recording::EventDetails, values);
+        if (detailsConnected) {
+            q->details(PackageKit::Details(values));
+        }
+    }
+    appendPackageDetails(details);
+}
+
+void TransactionPrivate::appendPackageDetails(const PackageKit::PackageDetails &details)
+{
+    pendingPackageDetails.append(details);
+    if (pendingPackageDetails.size() >= MaxBatchSize) {
+        flushPackageDetails();
+    }
+}
+
+void TransactionPrivate::flushPackageDetails()
+{
+    Q_Q(Transaction);
+    if (pendingPackageDetails.isEmpty()) {
+        return;
+    }
+
+    const QList<PackageKit::PackageDetails> details = std::move(pendingPackageDetails);
+    pendingPackageDetails.clear();
+    q->packageDetails(details);
+}
+
+void TransactionPrivate::Files(const QString &packageID, const QStringList &filenames)
+{
+    Q_Q(Transaction);
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::files))) {
+        q->files(packageID, filenames);
+    }
+
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::fileList))) {
+        pendingFiles.append(packageID, filenames);
+
+        if (pendingFiles.packageCount() >= MaxBatchSize) {
+            flushFiles();
+        }
+    }
+}
+
+void TransactionPrivate::FileLists(const PackageKit::FileList &files)
+{
+    Q_Q(Transaction);
+    PK_TRACE_SCOPE(traceScope, "Transaction::FileLists");
+    PK_TRACE_SCOPE_ARG(traceScope, "packages", files.packageCount());
+    MetricsPrivate::add(MetricsPrivate::SignalsReceived);
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::files))) {
+        for (int i = 0; i < files.packageCount(); ++i) {
+            q->files(files.packageID(i), files.files(i));
+        }
+    }
+
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::fileList)) && !files.isEmpty()) {
+        // Whatever came in singular signals before goes first
+        flushFiles();
+        q->fileList(files);
+    }
+}
+
+void TransactionPrivate::flushFiles()
+{
+    Q_Q(Transaction);
+    if (pendingFiles.isEmpty()) {
+        return;
+    }
+
+    const PackageKit::FileList files = pendingFiles;
+    pendingFiles.clear();
+    q->fileList(files);
 }
 
 void TransactionPrivate::distroUpgrade(uint type, const QString &name, const QString &description)
 {
     Q_Q(Transaction);
+    record(Recording::EventDistroUpgrade, type, name, description);
     q->distroUpgrade(static_cast<Transaction::DistroUpgrade>(type),
                      name,
                      description);
@@ -226,12 +367,14 @@ void TransactionPrivate::distroUpgrade(uint type, const QString &name, const QSt
 void TransactionPrivate::errorCode(uint error, const QString &details)
 {
     Q_Q(Transaction);
+    record(Recording::EventErrorCode, error, details);
     q->errorCode(static_cast<Transaction::Error>(error), details);
 }
 
 void TransactionPrivate::mediaChangeRequired(uint mediaType, const QString &mediaId, const QString &mediaText)
 {
     Q_Q(Transaction);
+    record(Recording::EventMediaChangeRequired, mediaType, mediaId, mediaText);
     q->mediaChangeRequired(static_cast<Transaction::MediaType>(mediaType),
                            mediaId,
                            mediaText);
@@ -240,14 +383,24 @@ void TransactionPrivate::mediaChangeRequired(uint mediaType, const QString &medi
 void TransactionPrivate::finished(uint exitCode, uint runtime)
 {
     Q_Q(Transaction);
+    record(Recording::EventFinished, exitCode, runtime);
+    flushTransactionRecords();
+    flushUpdateDetails();
+    flushPackageDetails();
+    flushFiles();
+    timings.mark(TransactionTimings::PhaseFinished);
+    PK_TRACE_END("Transaction", q, "exit", exitCode);
+    PK_TRACE_SCOPE(traceScope, "Transaction::finished");
     q->finished(static_cast<Transaction::Exit>(exitCode), runtime);
     sentFinished = true;
+    publishProgress(true);
     q->deleteLater();
 }
 
 void TransactionPrivate::destroy()
 {
     Q_Q(Transaction);
+    record(Recording::EventDestroy);
     if (p) {
        delete p;
        p = nullptr;
@@ -257,12 +410,20 @@ void TransactionPrivate::destroy()
        // If after we connect to a transaction we happend
        // to only receive destroyed signal send a finished
        // to the client
+       timings.mark(TransactionTimings::PhaseFinished);
+       PK_TRACE_END("Transaction", q, "exit", Transaction::ExitUnknown);
        q->finished(Transaction::ExitUnknown, 0);
     }
+    publishProgress(true);
 
     q->deleteLater();
 }
 
+void TransactionPrivate::signalReceived()
+{
+    MetricsPrivate::add(MetricsPrivate::SignalsReceived);
+}
+
 void TransactionPrivate::daemonQuit()
 {
     Q_Q(Transaction);
@@ -278,13 +439,19 @@ void TransactionPrivate::propertiesChanged(const QString &interface, const QVari
     Q_UNUSED(interface)
     Q_UNUSED(invalidatedProperties)
 
+    MetricsPrivate::add(MetricsPrivate::SignalsReceived);
     updateProperties(properties);
 }
 
 void TransactionPrivate::updateProperties(const QVariantMap &properties)
 {
     Q_Q(Transaction);
+    record(Recording::EventProperties, properties);
+    PK_TRACE_SCOPE(traceScope, "Transaction::updateProperties");
+    PK_TRACE_SCOPE_ARG(traceScope, "properties", properties.size());
+    timings.mark(TransactionTimings::PhaseFirstPropertyUpdate);
 
+    quint64 queued = 0;
     QVariantMap::ConstIterator it = properties.constBegin();
     while (it != properties.constEnd()) {
         const QString &property = it.key();
@@ -292,58 +459,84 @@ void TransactionPrivate::updateProperties(const QVariantMap &properties)
         if (property == QLatin1String("AllowCancel")) {
             allowCancel = value.toBool();
             QMetaObject::invokeMethod(q, &Transaction::allowCancelChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("CallerActive")) {
             callerActive = value.toBool();
             QMetaObject::invokeMethod(q, &Transaction::isCallerActiveChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("DownloadSizeRemaining")) {
             downloadSizeRemaining = value.toLongLong();
             QMetaObject::invokeMethod(q, &Transaction::downloadSizeRemainingChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("ElapsedTime")) {
             elapsedTime = value.toUInt();
             QMetaObject::invokeMethod(q, &Transaction::elapsedTimeChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("LastPackage")) {
             lastPackage = value.toString();
             QMetaObject::invokeMethod(q, &Transaction::lastPackageChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("Percentage")) {
             percentage = value.toUInt();
             QMetaObject::invokeMethod(q, &Transaction::percentageChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("RemainingTime")) {
             remainingTime = value.toUInt();
             q->remainingTimeChanged();
         } else if (property == QLatin1String("Role")) {
             role = static_cast<Transaction::Role>(value.toUInt());
             QMetaObject::invokeMethod(q, &Transaction::roleChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("Speed")) {
             speed = value.toUInt();
             QMetaObject::invokeMethod(q, &Transaction::speedChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("Status")) {
             status = static_cast<Transaction::Status>(value.toUInt());
             QMetaObject::invokeMethod(q, &Transaction::statusChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("TransactionFlags")) {
             transactionFlags = static_cast<Transaction::TransactionFlags>(value.toUInt());
             QMetaObject::invokeMethod(q, &Transaction::transactionFlagsChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("Uid")) {
             uid = value.toUInt();
             QMetaObject::invokeMethod(q, &Transaction::uidChanged, Qt::QueuedConnection);
+            ++queued;
         } else if (property == QLatin1String("Sender")) {
             senderName = value.toString();
             QMetaObject::invokeMethod(q, &Transaction::senderNameChanged, Qt::QueuedConnection);
+            ++queued;
         } else {
             qCWarning(PACKAGEKITQT_TRANSACTION) << "Unknown Transaction property:" << property << value;
         }
 
         ++it;
     }
+    MetricsPrivate::add(MetricsPrivate::QueuedPropertyNotifications, queued);
+    publishProgress();
+}
+
+void TransactionPrivate::publishProgress(bool finished) const
+{
+    if (progress) {
+        progress->publish({ status, percentage, elapsedTime, remainingTime, speed, downloadSizeRemaining, finished });
+    }
 }
 
 void TransactionPrivate::Package(uint info, const QString &pid, const QString &summary)
 {
     Q_Q(Transaction);
+    record(Recording::EventPackage, info, pid, summary);
 
     constexpr quint32 LOW_MASK  = 0x0000FFFFu;
     constexpr quint32 HIGH_MASK = 0xFFFF0000u;
     const auto infoPacked = static_cast<quint32>(info);
 
+    timings.mark(TransactionTimings::PhaseFirstPackage);
+    timings.mark(TransactionTimings::PhaseLastPackage);
+    MetricsPrivate::add(MetricsPrivate::PackagesEmitted);
+
     if ((infoPacked & HIGH_MASK) != 0) {
         // we have packed values
 
@@ -364,14 +557,26 @@ void TransactionPrivate::Package(uint info, const QString &pid, const QString &s
 void TransactionPrivate::Packages(const QList<PackageKit::PkPackage> &pkgs)
 {
     Q_Q(Transaction);
+    record(Recording::EventPackages, pkgs);
+    PK_TRACE_SCOPE(traceScope, "Transaction::Packages");
+    PK_TRACE_SCOPE_ARG(traceScope, "packages", pkgs.size());
+    MetricsPrivate::add(MetricsPrivate::SignalsReceived);
+    if (pkgs.isEmpty()) {
+        return;
+    }
+    MetricsPrivate::add(MetricsPrivate::PackagesEmitted, pkgs.size());
+
+    timings.mark(TransactionTimings::PhaseFirstPackage);
     for (PkPackage const &pkg : pkgs) {
         q->package(static_cast<Transaction::Info>(pkg.info), pkg.pid, pkg.summary);
     }
+    timings.mark(TransactionTimings::PhaseLastPackage);
 }
 
 void TransactionPrivate::ItemProgress(const QString &itemID, uint status, uint percentage)
 {
     Q_Q(Transaction);
+    record(Recording::EventItemProgress, itemID, status, percentage);
     q->itemProgress(itemID,
                     static_cast<PackageKit::Transaction::Status>(status),
                     percentage);
@@ -387,6 +592,7 @@ void TransactionPrivate::RepoSignatureRequired(const QString &pid,
                                                uint type)
 {
     Q_Q(Transaction);
+    record(Recording::EventRepoSignatureRequired, pid, repoName, keyUrl, keyUserid, keyId, keyFingerprint, keyTimestamp, type);
     q->repoSignatureRequired(pid,
                              repoName,
                              keyUrl,
@@ -400,6 +606,7 @@ void TransactionPrivate::RepoSignatureRequired(const QString &pid,
 void TransactionPrivate::requireRestart(uint type, const QString &pid)
 {
     Q_Q(Transaction);
+    record(Recording::EventRequireRestart, type, pid);
     q->requireRestart(static_cast<PackageKit::Transaction::Restart>(type), pid);
 }
 
@@ -410,20 +617,19 @@ void TransactionPrivate::transaction(const QDBusObjectPath &oldTid,
                                      uint duration,
                                      const QString &data,
                                      uint uid,
-                                     const QString &senderName,
                                      const QString &cmdline)
 {
     Q_Q(Transaction);
+    record(Recording::EventTransaction, oldTid.path(), timespec, succeeded, role, duration, data, uid, cmdline);
 
     auto priv = new TransactionPrivate(q);
-    priv->tid = tid;
-    priv->timespec = QDateTime::fromString(timespec, Qt::ISODate);
+    priv->tid = oldTid;
+    priv->timespec = IsoDate::toDateTime(timespec);
     priv->succeeded = succeeded;
     priv->role = static_cast<Transaction::Role>(role);
     priv->duration = duration;
     priv->data = data;
     priv->uid = uid;
-    priv->senderName = senderName;
     priv->cmdline = cmdline;
 
     auto transaction = new Transaction(priv);
@@ -432,6 +638,42 @@ void TransactionPrivate::transaction(const QDBusObjectPath &oldTid,
     q->transaction(transaction);
 }
 
+void TransactionPrivate::transactionRecord(const QDBusObjectPath &oldTid,
+                                           const QString &timespec,
+                                           bool succeeded,
+                                           uint role,
+                                           uint duration,
+                                           const QString &data,
+                                           uint uid,
+                                           const QString &cmdline)
+{
+    record(Recording::EventTransactionRecord, oldTid.path(), timespec, succeeded, role, duration, data, uid, cmdline);
+    pendingRecords.append(TransactionRecord(oldTid,
+                                            timespec,
+                                            succeeded,
+                                            static_cast<Transaction::Role>(role),
+                                            duration,
+                                            data,
+                                            uid,
+                                            cmdline));
+
+    if (pendingRecords.size() >= MaxBatchSize) {
+        flushTransactionRecords();
+    }
+}
+
+void TransactionPrivate::flushTransactionRecords()
+{
+    Q_Q(Transaction);
+    if (pendingRecords.isEmpty()) {
+        return;
+    }
+
+    const QList<TransactionRecord> records = std::move(pendingRecords);
+    pendingRecords.clear();
+    q->transactionRecords(records);
+}
+
 void TransactionPrivate::UpdateDetail(const QString &package_id,
                                       const QStringList &updates,
                                       const QStringList &obsoletes,
@@ -446,35 +688,114 @@ void TransactionPrivate::UpdateDetail(const QString &package_id,
                                       const QString &updated)
 {
     Q_Q(Transaction);
-    q->updateDetail(package_id,
-                    updates,
-                    obsoletes,
-                    vendor_urls,
-                    bugzilla_urls,
-                    cve_urls,
-                    static_cast<PackageKit::Transaction::Restart>(restart),
-                    update_text,
-                    changelog,
-                    static_cast<PackageKit::Transaction::UpdateState>(state),
-                    QDateTime::fromString(issued, Qt::ISODate),
-                    QDateTime::fromString(updated, Qt::ISODate));
+    record(Recording::EventUpdateDetail,
+           package_id,
+           updates,
+           obsoletes,
+           vendor_urls,
+           bugzilla_urls,
+           cve_urls,
+           restart,
+           update_text,
+           changelog,
+           state,
+           issued,
+           updated);
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::updateDetail))) {
+        q->updateDetail(package_id,
+                        updates,
+                        obsoletes,
+                        vendor_urls,
+                        bugzilla_urls,
+                        cve_urls,
+                        static_cast<PackageKit::Transaction::Restart>(restart),
+                        update_text,
+                        changelog,
+                        static_cast<PackageKit::Transaction::UpdateState>(state),
+                        IsoDate::toDateTime(issued),
+                        IsoDate::toDateTime(updated));
+    }
+
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::updateDetails))) {
+        pendingUpdateDetails.append(PackageKit::UpdateDetail(package_id,
+                                                             updates,
+                                                             obsoletes,
+                                                             vendor_urls,
+                                                             bugzilla_urls,
+                                                             cve_urls,
+                                                             static_cast<PackageKit::Transaction::Restart>(restart),
+                                                             update_text,
+                                                             changelog,
+                                                             static_cast<PackageKit::Transaction::UpdateState>(state),
+                                                             issued,
+                                                             updated));
+
+        if (pendingUpdateDetails.size() >= MaxBatchSize) {
+            flushUpdateDetails();
+        }
+    }
+}
+
+void TransactionPrivate::flushUpdateDetails()
+{
+    Q_Q(Transaction);
+    if (pendingUpdateDetails.isEmpty()) {
+        return;
+    }
+
+    const QList<PackageKit::UpdateDetail> details = std::move(pendingUpdateDetails);
+    pendingUpdateDetails.clear();
+    q->updateDetails(details);
 }
 
 void TransactionPrivate::UpdateDetails(const QList<PkDetail> &details)
 {
     Q_Q(Transaction);
-    for (const PkDetail &detail : details) {
-        q->updateDetail(detail.package_id,
-                        detail.updates,
-                        detail.obsoletes,
-                        detail.vendor_urls,
-                        detail.bugzilla_urls,
-                        detail.cve_urls,
-                        static_cast<PackageKit::Transaction::Restart>(detail.restart),
-                        detail.update_text,
-                        detail.changelog,
-                        static_cast<PackageKit::Transaction::UpdateState>(detail.state),
-                        QDateTime::fromString(detail.issued, Qt::ISODate),
-                        QDateTime::fromString(detail.updated, Qt::ISODate));
+    record(Recording::EventUpdateDetails, details);
+    PK_TRACE_SCOPE(traceScope, "Transaction::UpdateDetails");
+    PK_TRACE_SCOPE_ARG(traceScope, "updateDetails", details.size());
+    MetricsPrivate::add(MetricsPrivate::SignalsReceived);
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::updateDetail))) {
+        for (const PkDetail &detail : details) {
+            q->updateDetail(detail.package_id,
+                            detail.updates,
+                            detail.obsoletes,
+                            detail.vendor_urls,
+                            detail.bugzilla_urls,
+                            detail.cve_urls,
+                            static_cast<PackageKit::Transaction::Restart>(detail.restart),
+                            detail.update_text,
+                            detail.changelog,
+                            static_cast<PackageKit::Transaction::UpdateState>(detail.state),
+                            detail.timesParsed ? detail.issuedTime : IsoDate::toDateTime(detail.issued),
+                            detail.timesParsed ? detail.updatedTime : IsoDate::toDateTime(detail.updated));
+        }
+    }
+
+    if (connectedSignals.contains(QMetaMethod::fromSignal(&Transaction::updateDetails))) {
+        // Whatever came in singular signals before goes first
+        flushUpdateDetails();
+
+        QList<PackageKit::UpdateDetail> batch;
+        batch.reserve(details.size());
+        for (const PkDetail &detail : details) {
+            PackageKit::UpdateDetail entry(detail.package_id,
+                                           detail.updates,
+                                           detail.obsoletes,
+                                           detail.vendor_urls,
+                                           detail.bugzilla_urls,
+                                           detail.cve_urls,
+                                           static_cast<PackageKit::Transaction::Restart>(detail.restart),
+                                           detail.update_text,
+                                           detail.changelog,
+                                           static_cast<PackageKit::Transaction::UpdateState>(detail.state),
+                                           detail.issued,
+                                           detail.updated);
+            if (detail.timesParsed) {
+                entry.setDates(detail.issuedTime, detail.updatedTime);
+            }
+            batch.append(entry);
+        }
+        q->updateDetails(batch);
     }
 }
@@ -25,22 +25,40 @@
 #include <QString>
 #include <QList>
 #include <QStringList>
+#include <QDBusConnection>
 #include <QDBusPendingCallWatcher>
+#include <memory>
 #include <optional>
 
 #include "transaction.h"
+#include "filelist.h"
+#include "packagedetails.h"
 #include "transactionproxy.h"
+#include "transactionrecord.h"
+#include "updatedetail.h"
 
 Q_DECLARE_LOGGING_CATEGORY(PACKAGEKITQT_TRANSACTION)
 
 namespace PackageKit {
 
+// Results sent one signal at a time are collected and delivered as a batch
+// when the transaction finishes; a batch is flushed early once it reaches
+// this size, so a very long result doesn't sit in memory until the end and
+// then reach the client in one go
+constexpr int MaxBatchSize = 1000;
+
 struct PkPackage {
     uint info;
     QString pid;
     QString summary;
 };
 
+// Only used for the signature of FileLists, FileList decodes it itself
+struct PkFiles {
+    QString pid;
+    QStringList files;
+};
+
 struct PkDetail {
     QString package_id;
     QStringList updates;
@@ -54,12 +72,23 @@ struct PkDetail {
     uint state;
     QString issued;
     QString updated;
+
+    // Parsed ahead of time by TransactionDecoder, not sent over D-Bus
+    QDateTime issuedTime;
+    QDateTime updatedTime;
+    bool timesParsed = false;
 };
 
+class TransactionDecoder;
+class TransactionProgressPrivate;
+class TransactionRecorder;
 class TransactionPrivate
 {
     Q_DECLARE_PUBLIC(Transaction)
     friend class Daemon;
+    friend class TransactionRecorder;
+    friend class TransactionReplayer;
+    friend class TransactionReplayerPrivate;
 protected:
     TransactionPrivate(Transaction *parent);
     virtual ~TransactionPrivate();
@@ -70,6 +99,7 @@ protected:
     QDBusObjectPath tid;
     QPointer<::OrgFreedesktopPackageKitTransactionInterface> p;
     Transaction *q_ptr;
+    QDBusConnection connection;
     QVector<QMetaMethod> connectedSignals;
 
     qulonglong downloadSizeRemaining = 0;
@@ -116,7 +146,41 @@ protected:
     QString upgradeDistroId;
     Transaction::UpgradeKind upgradeKind;
 
+    // History entries not yet sent by transactionRecords()
+    QList<TransactionRecord> pendingRecords;
+
+    // Single UpdateDetail signals not yet sent by updateDetails()
+    QList<PackageKit::UpdateDetail> pendingUpdateDetails;
+    bool updateDetailsConnected = false;
+
+    // Files signals not yet sent by fileList()
+    PackageKit::FileList pendingFiles;
+    bool filesConnected = false;
+
+    // Details signals not yet sent by packageDetails()
+    QList<PackageKit::PackageDetails> pendingPackageDetails;
+    bool packageDetailsConnected = false;
+
+    TransactionTimings timings;
+
+    // Set while a TransactionRecorder records this transaction
+    TransactionRecorder *recorder = nullptr;
+
+    // Receives the plural signals when decoding on the worker thread
+    TransactionDecoder *decoder = nullptr;
+
+    // Created by Transaction::progress(), read by other threads
+    mutable std::shared_ptr<TransactionProgressPrivate> progress;
+
     void setupSignal(const QMetaMethod &signal);
+    void flushTransactionRecords();
+    void flushUpdateDetails();
+    void flushPackageDetails();
+    void flushFiles();
+    void publishProgress(bool finished = false) const;
+
+    template <typename... Args>
+    void record(quint8 event, const Args &...args);
 
 private:
     template <typename Func1, typename Func2>
@@ -124,10 +188,14 @@ private:
 
 protected Q_SLOTS:
     void details(const QVariantMap &values);
+    void Details(const PackageKit::PackageDetails &details);
+    void appendPackageDetails(const PackageKit::PackageDetails &details);
     void distroUpgrade(uint type, const QString &name, const QString &description);
     void errorCode(uint error, const QString &details);
     void mediaChangeRequired(uint mediaType, const QString &mediaId, const QString &mediaText);
     void finished(uint exitCode, uint runtime);
+    void Files(const QString &packageID, const QStringList &filenames);
+    void FileLists(const PackageKit::FileList &files);
     void Package(uint info, const QString &pid, const QString &summary);
     void Packages(const QList<PackageKit::PkPackage> &packages);
     void ItemProgress(const QString &itemID, uint status, uint percentage);
@@ -140,11 +208,13 @@ protected Q_SLOTS:
                                const QString &keyTimestamp,
                                uint type);
     void requireRestart(uint type, const QString &pid);
-    void transaction(const QDBusObjectPath &oldTid, const QString &timespec, bool succeeded, uint role, uint duration, const QString &data, uint uid, const QString &senderName, const QString &cmdline);
+    void transaction(const QDBusObjectPath &oldTid, const QString &timespec, bool succeeded, uint role, uint duration, const QString &data, uint uid, const QString &cmdline);
+    void transactionRecord(const QDBusObjectPath &oldTid, const QString &timespec, bool succeeded, uint role, uint duration, const QString &data, uint uid, const QString &cmdline);
     void UpdateDetail(const QString &package_id, const QStringList &updates, const QStringList &obsoletes, const QStringList &vendor_urls, const QStringList &bugzilla_urls, const QStringList &cve_urls, uint restart, const QString &update_text, const QString &changelog, uint state, const QString &issued, const QString &updated);
     void UpdateDetails(const QList<PackageKit::PkDetail> &details);
     void destroy();
     void daemonQuit();
+    void signalReceived();
     void propertiesChanged(const QString &interface, const QVariantMap &properties, const QStringList &invalidatedProperties);
     void updateProperties(const QVariantMap &properties);
 };
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactionprogress.h"
+#include "transactionprogressprivate.h"
+
+#include <QThread>
+
+using namespace PackageKit;
+
+void TransactionProgressPrivate::publish(const ProgressSnapshot &snapshot)
+{
+    const quint32 start = sequence.load(std::memory_order_relaxed);
+    sequence.store(start + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    status.store(snapshot.status, std::memory_order_relaxed);
+    percentage.store(snapshot.percentage, std::memory_order_relaxed);
+    elapsedTime.store(snapshot.elapsedTime, std::memory_order_relaxed);
+    remainingTime.store(snapshot.remainingTime, std::memory_order_relaxed);
+    speed.store(snapshot.speed, std::memory_order_relaxed);
+    downloadSizeRemaining.store(snapshot.downloadSizeRemaining, std::memory_order_relaxed);
+    finished.store(snapshot.finished, std::memory_order_relaxed);
+
+    sequence.store(start + 2, std::memory_order_release);
+}
+
+ProgressSnapshot TransactionProgressPrivate::read() const
+{
+    ProgressSnapshot snapshot;
+    for (;;) {
+        const quint32 before = sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            QThread::yieldCurrentThread();
+            continue;
+        }
+
+        snapshot.status = static_cast<Transaction::Status>(status.load(std::memory_order_relaxed));
+        snapshot.percentage = percentage.load(std::memory_order_relaxed);
+        snapshot.elapsedTime = elapsedTime.load(std::memory_order_relaxed);
+        snapshot.remainingTime = remainingTime.load(std::memory_order_relaxed);
+        snapshot.speed = speed.load(std::memory_order_relaxed);
+        snapshot.downloadSizeRemaining = downloadSizeRemaining.load(std::memory_order_relaxed);
+        snapshot.finished = finished.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before) {
+            return snapshot;
+        }
+    }
+}
+
+TransactionProgress::TransactionProgress() = default;
+
+TransactionProgress::TransactionProgress(const std::shared_ptr<TransactionProgressPrivate> &d)
+    : d(d)
+{
+}
+
+TransactionProgress::TransactionProgress(const TransactionProgress &other) = default;
+
+TransactionProgress::~TransactionProgress() = default;
+
+TransactionProgress &TransactionProgress::operator=(const TransactionProgress &other) = default;
+
+bool TransactionProgress::isValid() const
+{
+    return bool(d);
+}
+
+ProgressSnapshot TransactionProgress::snapshot() const
+{
+    return d ? d->read() : ProgressSnapshot();
+}
+
+quint32 TransactionProgress::generation() const
+{
+    return d ? d->sequence.load(std::memory_order_acquire) / 2 : 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_PROGRESS_H
+#define PACKAGEKIT_TRANSACTION_PROGRESS_H
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+#include <memory>
+
+namespace PackageKit {
+
+/**
+ * The progress of a transaction at one point in time
+ *
+ * \sa TransactionProgress
+ */
+struct ProgressSnapshot
+{
+    Transaction::Status status = Transaction::StatusUnknown;
+    uint percentage = 101;
+    uint elapsedTime = 0;
+    uint remainingTime = 0;
+    uint speed = 0;
+    qulonglong downloadSizeRemaining = 0;
+    bool finished = false;
+};
+
+/**
+ * \class TransactionProgress transactionprogress.h TransactionProgress
+ *
+ * \brief Reads the progress of a transaction from any thread
+ *
+ * Get one with Transaction::progress() on the thread the transaction lives
+ * in and hand copies of it to other threads, like a QtQuick render thread
+ * or a metrics exporter. snapshot() never locks or waits for the owning
+ * thread, it retries in the rare case it raced with an update, and always
+ * returns values published together. It keeps working after the
+ * transaction is deleted, returning its last progress.
+ */
+class TransactionProgressPrivate;
+class PACKAGEKITQT_LIBRARY TransactionProgress
+{
+public:
+    /**
+     * Creates an invalid object, snapshot() returns default values
+     */
+    TransactionProgress();
+    TransactionProgress(const TransactionProgress &other);
+    ~TransactionProgress();
+    TransactionProgress &operator=(const TransactionProgress &other);
+
+    bool isValid() const;
+
+    ProgressSnapshot snapshot() const;
+
+    /**
+     * Returns a number that changes each time new progress is published,
+     * to skip work when nothing changed since the last snapshot()
+     */
+    quint32 generation() const;
+
+private:
+    friend class Transaction;
+    explicit TransactionProgress(const std::shared_ptr<TransactionProgressPrivate> &d);
+
+    std::shared_ptr<TransactionProgressPrivate> d;
+};
+
+} // End namespace PackageKit
+
+#endif
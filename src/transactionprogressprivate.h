@@ -0,0 +1,57 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_PROGRESS_PRIVATE_H
+#define PACKAGEKIT_TRANSACTION_PROGRESS_PRIVATE_H
+
+#include "transactionprogress.h"
+
+#include <atomic>
+
+namespace PackageKit {
+
+/**
+ * A seqlock around the progress of one transaction
+ *
+ * Only the thread of the transaction writes: it makes the sequence odd,
+ * stores the values and makes it even again. Readers retry while it is
+ * odd or changed under them. Every value is an atomic of its own so
+ * readers racing a writer are well defined, they just throw the result
+ * away.
+ */
+class TransactionProgressPrivate
+{
+public:
+    void publish(const ProgressSnapshot &snapshot);
+    ProgressSnapshot read() const;
+
+    std::atomic<quint32> sequence = 0;
+    std::atomic<quint32> status = Transaction::StatusUnknown;
+    std::atomic<quint32> percentage = 101;
+    std::atomic<quint32> elapsedTime = 0;
+    std::atomic<quint32> remainingTime = 0;
+    std::atomic<quint32> speed = 0;
+    std::atomic<quint64> downloadSizeRemaining = 0;
+    std::atomic<bool> finished = false;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactionrecord.h"
+#include "isodate.h"
+
+#include <mutex>
+
+namespace PackageKit {
+
+class TransactionRecordData : public QSharedData
+{
+public:
+    QDBusObjectPath tid;
+    QString timespecString;
+    QString data;
+    QString cmdline;
+    uint duration = 0;
+    uint uid = 0;
+    Transaction::Role role = Transaction::RoleUnknown;
+    bool succeeded = false;
+
+    // Filled on first access, records may be shared between threads
+    mutable std::once_flag timespecOnce;
+    mutable QDateTime timespec;
+    mutable std::once_flag dataLinesOnce;
+    mutable QStringList dataLines;
+};
+
+}
+
+using namespace PackageKit;
+
+TransactionRecord::TransactionRecord() = default;
+
+TransactionRecord::TransactionRecord(const QDBusObjectPath &tid,
+                                     const QString &timespec,
+                                     bool succeeded,
+                                     Transaction::Role role,
+                                     uint duration,
+                                     const QString &data,
+                                     uint uid,
+                                     const QString &cmdline)
+    : d(new TransactionRecordData)
+{
+    d->tid = tid;
+    d->timespecString = timespec;
+    d->succeeded = succeeded;
+    d->role = role;
+    d->duration = duration;
+    d->data = data;
+    d->uid = uid;
+    d->cmdline = cmdline;
+}
+
+TransactionRecord::TransactionRecord(const TransactionRecord &other) = default;
+
+TransactionRecord::~TransactionRecord() = default;
+
+TransactionRecord &TransactionRecord::operator=(const TransactionRecord &other) = default;
+
+bool TransactionRecord::isValid() const
+{
+    return bool(d);
+}
+
+QDBusObjectPath TransactionRecord::tid() const
+{
+    return d ? d->tid : QDBusObjectPath();
+}
+
+QDateTime TransactionRecord::timespec() const
+{
+    if (!d) {
+        return QDateTime();
+    }
+    std::call_once(d->timespecOnce, [this] {
+        d->timespec = IsoDate::toDateTime(d->timespecString);
+    });
+    return d->timespec;
+}
+
+QString TransactionRecord::timespecString() const
+{
+    return d ? d->timespecString : QString();
+}
+
+bool TransactionRecord::succeeded() const
+{
+    return d && d->succeeded;
+}
+
+Transaction::Role TransactionRecord::role() const
+{
+    return d ? d->role : Transaction::RoleUnknown;
+}
+
+uint TransactionRecord::duration() const
+{
+    return d ? d->duration : 0;
+}
+
+QString TransactionRecord::data() const
+{
+    return d ? d->data : QString();
+}
+
+QStringList TransactionRecord::dataLines() const
+{
+    if (!d) {
+        return QStringList();
+    }
+    std::call_once(d->dataLinesOnce, [this] {
+        d->dataLines = d->data.split(QLatin1Char('\n'), Qt::SkipEmptyParts);
+    });
+    return d->dataLines;
+}
+
+uint TransactionRecord::uid() const
+{
+    return d ? d->uid : 0;
+}
+
+QString TransactionRecord::cmdline() const
+{
+    return d ? d->cmdline : QString();
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_RECORD_H
+#define PACKAGEKIT_TRANSACTION_RECORD_H
+
+#include <QtCore/QDateTime>
+#include <QtCore/QExplicitlySharedDataPointer>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+#include <QtCore/QStringList>
+#include <QtDBus/QDBusObjectPath>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class TransactionRecord transactionrecord.h TransactionRecord
+ *
+ * \brief An entry of the transaction history
+ *
+ * This is a light weight alternative to the Transaction objects sent by
+ * Transaction::transaction() for old transactions. The timestamp and the
+ * lines of data() are only parsed when first asked for.
+ *
+ * This class is implicitly shared.
+ *
+ * \sa Daemon::getOldTransactions(), Transaction::transactionRecords()
+ */
+class TransactionRecordData;
+class PACKAGEKITQT_LIBRARY TransactionRecord
+{
+public:
+    TransactionRecord();
+    TransactionRecord(const QDBusObjectPath &tid,
+                      const QString &timespec,
+                      bool succeeded,
+                      Transaction::Role role,
+                      uint duration,
+                      const QString &data,
+                      uint uid,
+                      const QString &cmdline);
+    TransactionRecord(const TransactionRecord &other);
+    ~TransactionRecord();
+
+    TransactionRecord &operator=(const TransactionRecord &other);
+
+    bool isValid() const;
+
+    /**
+     * The TID the transaction had while it was running
+     */
+    QDBusObjectPath tid() const;
+
+    /**
+     * Returns the date at which the transaction was created,
+     * parsed from timespecString() on first use
+     */
+    QDateTime timespec() const;
+
+    /**
+     * Returns the creation date as sent by the daemon
+     */
+    QString timespecString() const;
+
+    bool succeeded() const;
+
+    Transaction::Role role() const;
+
+    /**
+     * Returns the time the transaction took to finish in milliseconds
+     */
+    uint duration() const;
+
+    /**
+     * Returns the data the backend stored for the transaction, usually one
+     * "info\tpackage-id" line per package that was touched
+     */
+    QString data() const;
+
+    /**
+     * Returns data() split into lines, done once on first use
+     */
+    QStringList dataLines() const;
+
+    uint uid() const;
+
+    QString cmdline() const;
+
+private:
+    QExplicitlySharedDataPointer<TransactionRecordData> d;
+};
+
+} // End namespace PackageKit
+
+Q_DECLARE_METATYPE(PackageKit::TransactionRecord)
+
+#endif
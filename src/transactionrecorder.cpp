@@ -0,0 +1,195 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactionrecorder.h"
+#include "transactionrecorderprivate.h"
+#include "transactionprivate.h"
+
+#include <QFile>
+
+using namespace PackageKit;
+
+namespace PackageKit {
+
+QDataStream &operator<<(QDataStream &stream, const PkPackage &package)
+{
+    return stream << package.info << package.pid << package.summary;
+}
+
+QDataStream &operator>>(QDataStream &stream, PkPackage &package)
+{
+    return stream >> package.info >> package.pid >> package.summary;
+}
+
+QDataStream &operator<<(QDataStream &stream, const PkDetail &detail)
+{
+    return stream << detail.package_id
+                  << detail.updates
+                  << detail.obsoletes
+                  << detail.vendor_urls
+                  << detail.bugzilla_urls
+                  << detail.cve_urls
+                  << detail.restart
+                  << detail.update_text
+                  << detail.changelog
+                  << detail.state
+                  << detail.issued
+                  << detail.updated;
+}
+
+QDataStream &operator>>(QDataStream &stream, PkDetail &detail)
+{
+    return stream >> detail.package_id
+                  >> detail.updates
+                  >> detail.obsoletes
+                  >> detail.vendor_urls
+                  >> detail.bugzilla_urls
+                  >> detail.cve_urls
+                  >> detail.restart
+                  >> detail.update_text
+                  >> detail.changelog
+                  >> detail.state
+                  >> detail.issued
+                  >> detail.updated;
+}
+
+}
+
+TransactionRecorderPrivate::TransactionRecorderPrivate(TransactionRecorder *parent)
+    : q_ptr(parent)
+    , stream(&data, QIODevice::WriteOnly)
+{
+    stream.setVersion(Recording::StreamVersion);
+}
+
+TransactionRecorder::TransactionRecorder(QObject *parent)
+    : QObject(parent)
+    , d_ptr(new TransactionRecorderPrivate(this))
+{
+}
+
+TransactionRecorder::~TransactionRecorder()
+{
+    Q_D(TransactionRecorder);
+    if (d->transaction && d->transaction->d_ptr->recorder == this) {
+        d->transaction->d_ptr->recorder = nullptr;
+    }
+    delete d_ptr;
+}
+
+void TransactionRecorder::record(Transaction *transaction)
+{
+    Q_D(TransactionRecorder);
+
+    if (d->transaction) {
+        disconnect(d->transaction, nullptr, this, nullptr);
+        if (d->transaction->d_ptr->recorder == this) {
+            d->transaction->d_ptr->recorder = nullptr;
+        }
+    }
+
+    d->transaction = transaction;
+    d->role = transaction->role();
+    d->data.clear();
+    d->stream.device()->seek(0);
+    d->count = 0;
+    d->recording = true;
+    d->clock.start();
+    transaction->d_ptr->recorder = this;
+
+    // These are forwarded by Transaction without going through TransactionPrivate
+    connect(transaction, &Transaction::files,
+            this, [d] (const QString &packageID, const QStringList &filenames) {
+        if (d->recording) {
+            d->record(Recording::EventFiles, packageID, filenames);
+        }
+    });
+    connect(transaction, &Transaction::category,
+            this, [d] (const QString &parentId, const QString &categoryId, const QString &name, const QString &summary, const QString &icon) {
+        if (d->recording) {
+            d->record(Recording::EventCategory, parentId, categoryId, name, summary, icon);
+        }
+    });
+    connect(transaction, &Transaction::repoDetail,
+            this, [d] (const QString &repoId, const QString &description, bool enabled) {
+        if (d->recording) {
+            d->record(Recording::EventRepoDetail, repoId, description, enabled);
+        }
+    });
+    connect(transaction, &Transaction::eulaRequired,
+            this, [d] (const QString &eulaID, const QString &packageID, const QString &vendor, const QString &licenseAgreement) {
+        if (d->recording) {
+            d->record(Recording::EventEulaRequired, eulaID, packageID, vendor, licenseAgreement);
+        }
+    });
+
+    connect(transaction, &Transaction::finished, this, [this, d] {
+        // The role is usually only known once the properties came in
+        d->role = d->transaction->role();
+        d->recording = false;
+        Q_EMIT finished();
+    });
+}
+
+bool TransactionRecorder::isRecording() const
+{
+    Q_D(const TransactionRecorder);
+    return d->recording;
+}
+
+int TransactionRecorder::eventCount() const
+{
+    Q_D(const TransactionRecorder);
+    return d->count;
+}
+
+QByteArray TransactionRecorder::data() const
+{
+    Q_D(const TransactionRecorder);
+
+    QByteArray header;
+    QDataStream stream(&header, QIODevice::WriteOnly);
+    stream.setVersion(Recording::StreamVersion);
+    stream << Recording::Magic
+           << Recording::Version
+           << quint32(d->role)
+           << qint32(d->count);
+    return header + d->data;
+}
+
+bool TransactionRecorder::save(const QString &fileName)
+{
+    Q_D(TransactionRecorder);
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(data()) == -1) {
+        d->errorString = file.errorString();
+        return false;
+    }
+    return true;
+}
+
+QString TransactionRecorder::errorString() const
+{
+    Q_D(const TransactionRecorder);
+    return d->errorString;
+}
+
+#include "moc_transactionrecorder.cpp"
@@ -0,0 +1,100 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_RECORDER_H
+#define PACKAGEKIT_TRANSACTION_RECORDER_H
+
+#include <QtCore/QObject>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class TransactionRecorder transactionrecorder.h TransactionRecorder
+ *
+ * \brief Records what a transaction receives from the daemon
+ *
+ * Every signal and property update reaching the transaction is stored
+ * with the time it arrived, relative to record(). Only the signals the
+ * transaction receives are recorded, so connect to the transaction
+ * before it starts running, as usual.
+ *
+ * The recording can be saved and played back without a daemon by
+ * TransactionReplayer, for instance to benchmark the code handling the
+ * results of a large transaction.
+ *
+ * \code
+ * auto recorder = new TransactionRecorder(this);
+ * Transaction *transaction = Daemon::getPackages();
+ * connect(transaction, &Transaction::package, this, &MyClass::addPackage);
+ * recorder->record(transaction);
+ * connect(recorder, &TransactionRecorder::finished, this, [recorder] {
+ *     recorder->save(QStringLiteral("getpackages.pkrec"));
+ * });
+ * \endcode
+ */
+class TransactionRecorderPrivate;
+class PACKAGEKITQT_LIBRARY TransactionRecorder : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TransactionRecorder(QObject *parent = nullptr);
+    ~TransactionRecorder() override;
+
+    /**
+     * Starts recording \p transaction, dropping any previous recording
+     */
+    void record(Transaction *transaction);
+
+    /**
+     * Returns true until the recorded transaction finished
+     */
+    bool isRecording() const;
+
+    int eventCount() const;
+
+    /**
+     * Returns the recording, in the format save() writes
+     */
+    QByteArray data() const;
+
+    bool save(const QString &fileName);
+
+    QString errorString() const;
+
+Q_SIGNALS:
+    /**
+     * Emitted once the recorded transaction finished,
+     * the recording is complete then
+     */
+    void finished();
+
+private:
+    friend class TransactionPrivate;
+    Q_DECLARE_PRIVATE(TransactionRecorder)
+    TransactionRecorderPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_RECORDER_PRIVATE_H
+#define PACKAGEKIT_TRANSACTION_RECORDER_PRIVATE_H
+
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QPointer>
+
+#include "transactionrecorder.h"
+#include "common.h"
+
+namespace PackageKit {
+
+/**
+ * The file format shared by TransactionRecorder and TransactionReplayer
+ *
+ * A QDataStream holding the magic, the version and the role of the
+ * transaction, then one entry per event: the nanoseconds since recording
+ * started, the event type and the arguments of the matching
+ * TransactionPrivate slot or Transaction signal, in order.
+ */
+namespace Recording {
+
+constexpr quint32 Magic = 0x504b5250; // "PKRP"
+constexpr quint32 Version = 1;
+constexpr QDataStream::Version StreamVersion = QDataStream::Qt_6_0;
+
+enum Event : quint8 {
+    EventProperties,
+    EventPackage,
+    EventPackages,
+    EventDetails,
+    EventUpdateDetail,
+    EventUpdateDetails,
+    EventFiles,
+    EventCategory,
+    EventRepoDetail,
+    EventEulaRequired,
+    EventDistroUpgrade,
+    EventErrorCode,
+    EventMediaChangeRequired,
+    EventItemProgress,
+    EventRepoSignatureRequired,
+    EventRequireRestart,
+    EventTransaction,
+    EventTransactionRecord,
+    EventFinished,
+    EventDestroy
+};
+
+}
+
+QDataStream &operator<<(QDataStream &stream, const PkPackage &package);
+QDataStream &operator>>(QDataStream &stream, PkPackage &package);
+QDataStream &operator<<(QDataStream &stream, const PkDetail &detail);
+QDataStream &operator>>(QDataStream &stream, PkDetail &detail);
+
+class TransactionRecorderPrivate
+{
+    Q_DECLARE_PUBLIC(TransactionRecorder)
+public:
+    explicit TransactionRecorderPrivate(TransactionRecorder *parent);
+
+    template <typename... Args>
+    void record(Recording::Event event, const Args &...args)
+    {
+        stream << clock.nsecsElapsed() << quint8(event);
+        (stream << ... << args);
+        ++count;
+    }
+
+    TransactionRecorder *q_ptr;
+    QPointer<Transaction> transaction;
+    QByteArray data;
+    QDataStream stream;
+    QElapsedTimer clock;
+    QString errorString;
+    Transaction::Role role = Transaction::RoleUnknown;
+    int count = 0;
+    bool recording = false;
+};
+
+} // End namespace PackageKit
+
+#endif
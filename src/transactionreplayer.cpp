@@ -0,0 +1,392 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactionreplayer.h"
+#include "transactionrecorderprivate.h"
+#include "transactionprivate.h"
+
+#include <QBuffer>
+#include <QFile>
+#include <QTimer>
+
+#include <memory>
+
+using namespace PackageKit;
+
+namespace PackageKit {
+
+class TransactionReplayerPrivate
+{
+public:
+    static bool deliver(QDataStream &stream, quint8 event, Transaction *transaction, TransactionPrivate *priv);
+
+    QByteArray data;
+    QString errorString;
+    Transaction::Role role = Transaction::RoleUnknown;
+    int count = 0;
+};
+
+}
+
+namespace {
+
+// The state of one replay(), shared with the timer driving it
+struct ReplaySession
+{
+    explicit ReplaySession(const QByteArray &data)
+        : data(data)
+        , buffer(&this->data)
+        , stream(&buffer)
+    {
+        buffer.open(QIODevice::ReadOnly);
+        stream.setVersion(Recording::StreamVersion);
+    }
+
+    QByteArray data;
+    QBuffer buffer;
+    QDataStream stream;
+    QElapsedTimer clock;
+    qint64 nextTime = 0;
+    quint8 nextEvent = 0;
+    bool pending = false;
+};
+
+// Reads all of \p args, nothing from a cut short event may be delivered
+template <typename... Args>
+bool readEvent(QDataStream &stream, Args &...args)
+{
+    (stream >> ... >> args);
+    return stream.status() == QDataStream::Ok;
+}
+
+}
+
+bool TransactionReplayerPrivate::deliver(QDataStream &stream, quint8 event, Transaction *transaction, TransactionPrivate *priv)
+{
+    switch (event) {
+    case Recording::EventProperties: {
+        QVariantMap properties;
+        if (!readEvent(stream, properties)) {
+            return false;
+        }
+        priv->updateProperties(properties);
+        break;
+    }
+    case Recording::EventPackage: {
+        uint info;
+        QString pid, summary;
+        if (!readEvent(stream, info, pid, summary)) {
+            return false;
+        }
+        priv->Package(info, pid, summary);
+        break;
+    }
+    case Recording::EventPackages: {
+        QList<PkPackage> packages;
+        if (!readEvent(stream, packages)) {
+            return false;
+        }
+        priv->Packages(packages);
+        break;
+    }
+    case Recording::EventDetails: {
+        QVariantMap values;
+        if (!readEvent(stream, values)) {
+            return false;
+        }
+        priv->details(values);
+        break;
+    }
+    case Recording::EventUpdateDetail: {
+        PkDetail detail;
+        if (!readEvent(stream, detail)) {
+            return false;
+        }
+        priv->UpdateDetail(detail.package_id,
+                           detail.updates,
+                           detail.obsoletes,
+                           detail.vendor_urls,
+                           detail.bugzilla_urls,
+                           detail.cve_urls,
+                           detail.restart,
+                           detail.update_text,
+                           detail.changelog,
+                           detail.state,
+                           detail.issued,
+                           detail.updated);
+        break;
+    }
+    case Recording::EventUpdateDetails: {
+        QList<PkDetail> details;
+        if (!readEvent(stream, details)) {
+            return false;
+        }
+        priv->UpdateDetails(details);
+        break;
+    }
+    case Recording::EventFiles: {
+        QString packageID;
+        QStringList filenames;
+        if (!readEvent(stream, packageID, filenames)) {
+            return false;
+        }
+        priv->Files(packageID, filenames);
+        break;
+    }
+    case Recording::EventCategory: {
+        QString parentId, categoryId, name, summary, icon;
+        if (!readEvent(stream, parentId, categoryId, name, summary, icon)) {
+            return false;
+        }
+        Q_EMIT transaction->category(parentId, categoryId, name, summary, icon);
+        break;
+    }
+    case Recording::EventRepoDetail: {
+        QString repoId, description;
+        bool enabled;
+        if (!readEvent(stream, repoId, description, enabled)) {
+            return false;
+        }
+        Q_EMIT transaction->repoDetail(repoId, description, enabled);
+        break;
+    }
+    case Recording::EventEulaRequired: {
+        QString eulaID, packageID, vendor, licenseAgreement;
+        if (!readEvent(stream, eulaID, packageID, vendor, licenseAgreement)) {
+            return false;
+        }
+        Q_EMIT transaction->eulaRequired(eulaID, packageID, vendor, licenseAgreement);
+        break;
+    }
+    case Recording::EventDistroUpgrade: {
+        uint type;
+        QString name, description;
+        if (!readEvent(stream, type, name, description)) {
+            return false;
+        }
+        priv->distroUpgrade(type, name, description);
+        break;
+    }
+    case Recording::EventErrorCode: {
+        uint error;
+        QString details;
+        if (!readEvent(stream, error, details)) {
+            return false;
+        }
+        priv->errorCode(error, details);
+        break;
+    }
+    case Recording::EventMediaChangeRequired: {
+        uint mediaType;
+        QString mediaId, mediaText;
+        if (!readEvent(stream, mediaType, mediaId, mediaText)) {
+            return false;
+        }
+        priv->mediaChangeRequired(mediaType, mediaId, mediaText);
+        break;
+    }
+    case Recording::EventItemProgress: {
+        QString itemID;
+        uint status, percentage;
+        if (!readEvent(stream, itemID, status, percentage)) {
+            return false;
+        }
+        priv->ItemProgress(itemID, status, percentage);
+        break;
+    }
+    case Recording::EventRepoSignatureRequired: {
+        QString pid, repoName, keyUrl, keyUserid, keyId, keyFingerprint, keyTimestamp;
+        uint type;
+        if (!readEvent(stream, pid, repoName, keyUrl, keyUserid, keyId, keyFingerprint, keyTimestamp, type)) {
+            return false;
+        }
+        priv->RepoSignatureRequired(pid, repoName, keyUrl, keyUserid, keyId, keyFingerprint, keyTimestamp, type);
+        break;
+    }
+    case Recording::EventRequireRestart: {
+        uint type;
+        QString pid;
+        if (!readEvent(stream, type, pid)) {
+            return false;
+        }
+        priv->requireRestart(type, pid);
+        break;
+    }
+    case Recording::EventTransaction:
+    case Recording::EventTransactionRecord: {
+        QString oldTid, timespec, data, cmdline;
+        bool succeeded;
+        uint role, duration, uid;
+        if (!readEvent(stream, oldTid, timespec, succeeded, role, duration, data, uid, cmdline)) {
+            return false;
+        }
+        if (event == Recording::EventTransaction) {
+            priv->transaction(QDBusObjectPath(oldTid), timespec, succeeded, role, duration, data, uid, cmdline);
+        } else {
+            priv->transactionRecord(QDBusObjectPath(oldTid), timespec, succeeded, role, duration, data, uid, cmdline);
+        }
+        break;
+    }
+    case Recording::EventFinished: {
+        uint exitCode, runtime;
+        if (!readEvent(stream, exitCode, runtime)) {
+            return false;
+        }
+        priv->finished(exitCode, runtime);
+        break;
+    }
+    case Recording::EventDestroy:
+        priv->destroy();
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+TransactionReplayer::TransactionReplayer(QObject *parent)
+    : QObject(parent)
+    , d_ptr(new TransactionReplayerPrivate)
+{
+}
+
+TransactionReplayer::~TransactionReplayer()
+{
+    delete d_ptr;
+}
+
+bool TransactionReplayer::load(const QString &fileName)
+{
+    Q_D(TransactionReplayer);
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        d->errorString = file.errorString();
+        return false;
+    }
+    return load(file.readAll());
+}
+
+bool TransactionReplayer::load(const QByteArray &data)
+{
+    Q_D(TransactionReplayer);
+
+    d->data.clear();
+    d->role = Transaction::RoleUnknown;
+    d->count = 0;
+
+    QDataStream stream(data);
+    stream.setVersion(Recording::StreamVersion);
+    quint32 magic, version, role;
+    qint32 count;
+    stream >> magic >> version >> role >> count;
+    if (stream.status() != QDataStream::Ok || magic != Recording::Magic) {
+        d->errorString = QStringLiteral("Not a transaction recording");
+        return false;
+    }
+    if (version != Recording::Version) {
+        d->errorString = QLatin1String("Unsupported recording version ") + QString::number(version);
+        return false;
+    }
+
+    d->data = data.mid(stream.device()->pos());
+    d->role = static_cast<Transaction::Role>(role);
+    d->count = count;
+    d->errorString.clear();
+    return true;
+}
+
+QString TransactionReplayer::errorString() const
+{
+    Q_D(const TransactionReplayer);
+    return d->errorString;
+}
+
+Transaction::Role TransactionReplayer::role() const
+{
+    Q_D(const TransactionReplayer);
+    return d->role;
+}
+
+int TransactionReplayer::eventCount() const
+{
+    Q_D(const TransactionReplayer);
+    return d->count;
+}
+
+Transaction *TransactionReplayer::replay(Speed speed)
+{
+    Q_D(TransactionReplayer);
+
+    if (d->data.isEmpty()) {
+        d->errorString = QStringLiteral("No recording loaded");
+        return nullptr;
+    }
+
+    auto priv = new TransactionPrivate(nullptr);
+    priv->role = d->role;
+    auto transaction = new Transaction(priv);
+    priv->q_ptr = transaction;
+
+    auto session = std::make_shared<ReplaySession>(d->data);
+    auto timer = new QTimer(transaction);
+    timer->setSingleShot(true);
+    connect(timer, &QTimer::timeout, transaction, [session, timer, transaction, priv, speed] {
+        if (!session->clock.isValid()) {
+            session->clock.start();
+        }
+
+        QDataStream &stream = session->stream;
+        while (session->pending || !stream.atEnd()) {
+            if (!session->pending) {
+                if (!readEvent(stream, session->nextTime, session->nextEvent)) {
+                    qCWarning(PACKAGEKITQT_TRANSACTION) << "Stopped replaying at a truncated event";
+                    break;
+                }
+                session->pending = true;
+            }
+
+            if (speed == SpeedOriginal) {
+                const qint64 wait = (session->nextTime - session->clock.nsecsElapsed()) / 1000000;
+                if (wait > 0) {
+                    timer->start(int(wait));
+                    return;
+                }
+            }
+
+            session->pending = false;
+            if (!TransactionReplayerPrivate::deliver(stream, session->nextEvent, transaction, priv)) {
+                qCWarning(PACKAGEKITQT_TRANSACTION) << "Stopped replaying at a corrupt event" << session->nextEvent;
+                break;
+            }
+        }
+
+        // Clients wait for finished() even when the recording was cut short
+        if (!priv->timings.hasPhase(TransactionTimings::PhaseFinished)) {
+            priv->errorCode(Transaction::ErrorInternalError, QStringLiteral("The transaction recording is truncated or corrupt"));
+            priv->finished(Transaction::ExitFailed, 0);
+        }
+    });
+    timer->start(0);
+
+    return transaction;
+}
+
+#include "moc_transactionreplayer.cpp"
@@ -0,0 +1,89 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_REPLAYER_H
+#define PACKAGEKIT_TRANSACTION_REPLAYER_H
+
+#include <QtCore/QObject>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class TransactionReplayer transactionreplayer.h TransactionReplayer
+ *
+ * \brief Plays back a recording made by TransactionRecorder
+ *
+ * replay() returns a Transaction that emits the recorded signals, going
+ * through the same code as a transaction talking to the daemon but
+ * without any D-Bus connection. The D-Bus messages themselves are not
+ * decoded again, everything after that is.
+ *
+ * Like other transactions it deletes itself after finished().
+ */
+class TransactionReplayerPrivate;
+class PACKAGEKITQT_LIBRARY TransactionReplayer : public QObject
+{
+    Q_OBJECT
+public:
+    enum Speed {
+        SpeedOriginal, /** < Keeps the time between events as recorded */
+        SpeedMaximum   /** < Sends all events from a single event loop iteration */
+    };
+    Q_ENUM(Speed)
+
+    explicit TransactionReplayer(QObject *parent = nullptr);
+    ~TransactionReplayer() override;
+
+    bool load(const QString &fileName);
+
+    /**
+     * Loads a recording returned by TransactionRecorder::data()
+     */
+    bool load(const QByteArray &data);
+
+    QString errorString() const;
+
+    /**
+     * Returns the role of the recorded transaction
+     */
+    Transaction::Role role() const;
+
+    int eventCount() const;
+
+    /**
+     * Returns a new transaction playing the loaded recording back
+     *
+     * The events start being sent once the event loop runs, connect to
+     * the transaction right away. Returns nullptr if nothing was loaded.
+     */
+    Transaction *replay(Speed speed = SpeedMaximum);
+
+private:
+    Q_DECLARE_PRIVATE(TransactionReplayer)
+    TransactionReplayerPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
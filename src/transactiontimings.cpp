@@ -0,0 +1,56 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "transactiontimings.h"
+
+#include <QDeadlineTimer>
+
+using namespace PackageKit;
+
+TransactionTimings::TransactionTimings()
+{
+}
+
+bool TransactionTimings::hasPhase(Phase phase) const
+{
+    return m_timestamps[phase] != 0;
+}
+
+qint64 TransactionTimings::timestamp(Phase phase) const
+{
+    return m_timestamps[phase];
+}
+
+qint64 TransactionTimings::elapsed(Phase from, Phase to) const
+{
+    if (!hasPhase(from) || !hasPhase(to)) {
+        return -1;
+    }
+    return m_timestamps[to] - m_timestamps[from];
+}
+
+void TransactionTimings::mark(Phase phase)
+{
+    if (!hasPhase(phase) || phase == PhaseLastPackage) {
+        m_timestamps[phase] = QDeadlineTimer::current(Qt::PreciseTimer).deadlineNSecs();
+    }
+}
+
+#include "moc_transactiontimings.cpp"
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_TRANSACTION_TIMINGS_H
+#define PACKAGEKIT_TRANSACTION_TIMINGS_H
+
+#include <QtCore/QMetaType>
+#include <QtCore/QObject>
+
+#include <packagekitqt_global.h>
+
+namespace PackageKit {
+
+/**
+ * \class TransactionTimings transactiontimings.h TransactionTimings
+ *
+ * \brief When a transaction went through each phase of its life
+ *
+ * Timestamps are in nanoseconds on the monotonic clock used by
+ * QDeadlineTimer, they can only be compared with each other. The
+ * phases before PhaseSetUp and after PhaseFinished are client side,
+ * the time between PhaseMethodAcknowledged and PhaseFinished is
+ * mostly spent by the daemon.
+ *
+ * \sa Transaction::timings(), Transaction::setTimingsObserver()
+ */
+class PACKAGEKITQT_LIBRARY TransactionTimings
+{
+    Q_GADGET
+public:
+    enum Phase {
+        PhaseConstructed,         /** < The Transaction object was created */
+        PhaseCreated,             /** < CreateTransaction replied with the transaction path */
+        PhaseSetUp,               /** < The proxy is ready and the role method is about to be called */
+        PhaseMethodAcknowledged,  /** < The daemon replied to the role method */
+        PhaseFirstPropertyUpdate, /** < The first transaction properties arrived */
+        PhaseFirstPackage,        /** < The first package() was emitted */
+        PhaseLastPackage,         /** < The last package() was emitted */
+        PhaseFinished,            /** < finished() was emitted */
+        PhaseDestroyed            /** < The Transaction object is being deleted */
+    };
+    Q_ENUM(Phase)
+
+    static constexpr int PhaseCount = PhaseDestroyed + 1;
+
+    TransactionTimings();
+
+    /**
+     * Returns true if the transaction went through \p phase
+     */
+    bool hasPhase(Phase phase) const;
+
+    /**
+     * Returns when the transaction went through \p phase, or 0 if it did not
+     */
+    qint64 timestamp(Phase phase) const;
+
+    /**
+     * Returns the nanoseconds between \p from and \p to, or -1 if
+     * the transaction did not go through both of them
+     */
+    qint64 elapsed(Phase from, Phase to) const;
+
+private:
+    friend class Transaction;
+    friend class TransactionPrivate;
+
+    /**
+     * Records \p phase as reached now, only the first time except
+     * for PhaseLastPackage which is updated every time
+     */
+    void mark(Phase phase);
+
+    qint64 m_timestamps[PhaseCount] = {};
+};
+
+} // End namespace PackageKit
+
+Q_DECLARE_METATYPE(PackageKit::TransactionTimings)
+
+#endif
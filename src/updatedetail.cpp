@@ -0,0 +1,186 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "updatedetail.h"
+#include "isodate.h"
+
+#include <mutex>
+
+namespace PackageKit {
+
+class UpdateDetailData : public QSharedData
+{
+public:
+    QString packageId;
+    QStringList updates;
+    QStringList obsoletes;
+    QStringList vendorUrls;
+    QStringList bugzillaUrls;
+    QStringList cveUrls;
+    QString updateText;
+    QString changelog;
+    QString issuedString;
+    QString updatedString;
+    Transaction::Restart restart = Transaction::RestartUnknown;
+    Transaction::UpdateState state = Transaction::UpdateStateUnknown;
+
+    // Filled on first access, details may be shared between threads
+    mutable std::once_flag issuedOnce;
+    mutable QDateTime issued;
+    mutable std::once_flag updatedOnce;
+    mutable QDateTime updated;
+};
+
+}
+
+using namespace PackageKit;
+
+UpdateDetail::UpdateDetail() = default;
+
+UpdateDetail::UpdateDetail(const QString &packageId,
+                           const QStringList &updates,
+                           const QStringList &obsoletes,
+                           const QStringList &vendorUrls,
+                           const QStringList &bugzillaUrls,
+                           const QStringList &cveUrls,
+                           Transaction::Restart restart,
+                           const QString &updateText,
+                           const QString &changelog,
+                           Transaction::UpdateState state,
+                           const QString &issued,
+                           const QString &updated)
+    : d(new UpdateDetailData)
+{
+    d->packageId = packageId;
+    d->updates = updates;
+    d->obsoletes = obsoletes;
+    d->vendorUrls = vendorUrls;
+    d->bugzillaUrls = bugzillaUrls;
+    d->cveUrls = cveUrls;
+    d->restart = restart;
+    d->updateText = updateText;
+    d->changelog = changelog;
+    d->state = state;
+    d->issuedString = issued;
+    d->updatedString = updated;
+}
+
+UpdateDetail::UpdateDetail(const UpdateDetail &other) = default;
+
+UpdateDetail::~UpdateDetail() = default;
+
+UpdateDetail &UpdateDetail::operator=(const UpdateDetail &other) = default;
+
+bool UpdateDetail::isValid() const
+{
+    return bool(d);
+}
+
+QString UpdateDetail::packageId() const
+{
+    return d ? d->packageId : QString();
+}
+
+QStringList UpdateDetail::updates() const
+{
+    return d ? d->updates : QStringList();
+}
+
+QStringList UpdateDetail::obsoletes() const
+{
+    return d ? d->obsoletes : QStringList();
+}
+
+QStringList UpdateDetail::vendorUrls() const
+{
+    return d ? d->vendorUrls : QStringList();
+}
+
+QStringList UpdateDetail::bugzillaUrls() const
+{
+    return d ? d->bugzillaUrls : QStringList();
+}
+
+QStringList UpdateDetail::cveUrls() const
+{
+    return d ? d->cveUrls : QStringList();
+}
+
+Transaction::Restart UpdateDetail::restart() const
+{
+    return d ? d->restart : Transaction::RestartUnknown;
+}
+
+QString UpdateDetail::updateText() const
+{
+    return d ? d->updateText : QString();
+}
+
+QString UpdateDetail::changelog() const
+{
+    return d ? d->changelog : QString();
+}
+
+Transaction::UpdateState UpdateDetail::state() const
+{
+    return d ? d->state : Transaction::UpdateStateUnknown;
+}
+
+QDateTime UpdateDetail::issued() const
+{
+    if (!d) {
+        return QDateTime();
+    }
+    std::call_once(d->issuedOnce, [this] {
+        d->issued = IsoDate::toDateTime(d->issuedString);
+    });
+    return d->issued;
+}
+
+QString UpdateDetail::issuedString() const
+{
+    return d ? d->issuedString : QString();
+}
+
+QDateTime UpdateDetail::updated() const
+{
+    if (!d) {
+        return QDateTime();
+    }
+    std::call_once(d->updatedOnce, [this] {
+        d->updated = IsoDate::toDateTime(d->updatedString);
+    });
+    return d->updated;
+}
+
+QString UpdateDetail::updatedString() const
+{
+    return d ? d->updatedString : QString();
+}
+
+void UpdateDetail::setDates(const QDateTime &issued, const QDateTime &updated)
+{
+    std::call_once(d->issuedOnce, [this, &issued] {
+        d->issued = issued;
+    });
+    std::call_once(d->updatedOnce, [this, &updated] {
+        d->updated = updated;
+    });
+}
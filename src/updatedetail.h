@@ -0,0 +1,129 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_UPDATE_DETAIL_H
+#define PACKAGEKIT_UPDATE_DETAIL_H
+
+#include <QtCore/QDateTime>
+#include <QtCore/QExplicitlySharedDataPointer>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+#include <QtCore/QStringList>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+
+namespace PackageKit {
+
+/**
+ * \class UpdateDetail updatedetail.h UpdateDetail
+ *
+ * \brief The details of one update
+ *
+ * Holds what Transaction::updateDetail() sends as separate arguments.
+ * The strings are kept as they were decoded from D-Bus, the issued and
+ * updated dates are only parsed when first asked for.
+ *
+ * This class is implicitly shared.
+ *
+ * \sa Transaction::updateDetails(), Daemon::getUpdatesDetails()
+ */
+class UpdateDetailData;
+class PACKAGEKITQT_LIBRARY UpdateDetail
+{
+public:
+    UpdateDetail();
+    UpdateDetail(const QString &packageId,
+                 const QStringList &updates,
+                 const QStringList &obsoletes,
+                 const QStringList &vendorUrls,
+                 const QStringList &bugzillaUrls,
+                 const QStringList &cveUrls,
+                 Transaction::Restart restart,
+                 const QString &updateText,
+                 const QString &changelog,
+                 Transaction::UpdateState state,
+                 const QString &issued,
+                 const QString &updated);
+    UpdateDetail(const UpdateDetail &other);
+    ~UpdateDetail();
+
+    UpdateDetail &operator=(const UpdateDetail &other);
+
+    bool isValid() const;
+
+    QString packageId() const;
+
+    /**
+     * The packages this update replaces
+     */
+    QStringList updates() const;
+
+    QStringList obsoletes() const;
+
+    QStringList vendorUrls() const;
+
+    QStringList bugzillaUrls() const;
+
+    QStringList cveUrls() const;
+
+    Transaction::Restart restart() const;
+
+    QString updateText() const;
+
+    QString changelog() const;
+
+    Transaction::UpdateState state() const;
+
+    /**
+     * Returns when the update was issued, parsed from issuedString() on first use
+     */
+    QDateTime issued() const;
+
+    /**
+     * Returns the issue date as sent by the daemon
+     */
+    QString issuedString() const;
+
+    /**
+     * Returns when the update was last changed, parsed from updatedString() on first use
+     */
+    QDateTime updated() const;
+
+    /**
+     * Returns the date of the last change as sent by the daemon
+     */
+    QString updatedString() const;
+
+private:
+    friend class TransactionPrivate;
+    void setDates(const QDateTime &issued, const QDateTime &updated);
+
+    QExplicitlySharedDataPointer<UpdateDetailData> d;
+};
+
+typedef QList<UpdateDetail> UpdateDetailList;
+
+} // End namespace PackageKit
+
+Q_DECLARE_METATYPE(PackageKit::UpdateDetail)
+
+#endif
@@ -0,0 +1,271 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "updatetracker.h"
+
+#include "daemon.h"
+#include "updatedetail.h"
+
+#include <QHash>
+#include <QMetaMethod>
+#include <QSet>
+
+namespace PackageKit {
+
+class UpdateTrackerPrivate
+{
+    Q_DECLARE_PUBLIC(UpdateTracker)
+public:
+    struct Entry {
+        Transaction::Info info;
+        QString summary;
+    };
+
+    UpdateTrackerPrivate(UpdateTracker *parent) : q_ptr(parent) {}
+
+    void updatesFinished(Transaction::Exit status);
+    void requestDetails(const QStringList &packageIDs);
+    void finish();
+
+    UpdateTracker *q_ptr;
+    Transaction::Filters filters;
+    QHash<QString, Entry> updates;
+    QHash<QString, Entry> pending;
+    // Updates whose details were requested but not received, asked again on the next refresh
+    QSet<QString> missingDetails;
+    bool busy = false;
+    bool refreshQueued = false;
+    bool fetchDetails = true;
+};
+
+}
+
+using namespace PackageKit;
+
+UpdateTracker::UpdateTracker(Transaction::Filters filters, QObject *parent)
+    : QObject(parent)
+    , d_ptr(new UpdateTrackerPrivate(this))
+{
+    Q_D(UpdateTracker);
+    d->filters = filters;
+
+    connect(Daemon::global(), &Daemon::updatesChanged, this, &UpdateTracker::refresh);
+
+    // Let the caller connect to our signals before the first results arrive
+    QMetaObject::invokeMethod(this, &UpdateTracker::refresh, Qt::QueuedConnection);
+}
+
+UpdateTracker::~UpdateTracker()
+{
+    delete d_ptr;
+}
+
+Transaction::Filters UpdateTracker::filters() const
+{
+    Q_D(const UpdateTracker);
+    return d->filters;
+}
+
+QStringList UpdateTracker::packageIds() const
+{
+    Q_D(const UpdateTracker);
+    return d->updates.keys();
+}
+
+bool UpdateTracker::contains(const QString &packageID) const
+{
+    Q_D(const UpdateTracker);
+    return d->updates.contains(packageID);
+}
+
+Transaction::Info UpdateTracker::info(const QString &packageID) const
+{
+    Q_D(const UpdateTracker);
+    const auto it = d->updates.constFind(packageID);
+    return it == d->updates.constEnd() ? Transaction::InfoUnknown : it->info;
+}
+
+QString UpdateTracker::summary(const QString &packageID) const
+{
+    Q_D(const UpdateTracker);
+    const auto it = d->updates.constFind(packageID);
+    return it == d->updates.constEnd() ? QString() : it->summary;
+}
+
+int UpdateTracker::count() const
+{
+    Q_D(const UpdateTracker);
+    return d->updates.size();
+}
+
+bool UpdateTracker::isBusy() const
+{
+    Q_D(const UpdateTracker);
+    return d->busy;
+}
+
+bool UpdateTracker::fetchDetails() const
+{
+    Q_D(const UpdateTracker);
+    return d->fetchDetails;
+}
+
+void UpdateTracker::setFetchDetails(bool fetch)
+{
+    Q_D(UpdateTracker);
+    d->fetchDetails = fetch;
+}
+
+void UpdateTracker::refresh()
+{
+    Q_D(UpdateTracker);
+    if (d->busy) {
+        // Coalesce all changes seen while busy into a single new query
+        d->refreshQueued = true;
+        return;
+    }
+
+    d->busy = true;
+    Q_EMIT busyChanged();
+
+    d->pending.clear();
+    Transaction *transaction = Daemon::getUpdates(d->filters);
+    connect(transaction, &Transaction::package,
+            this, [d] (Transaction::Info info, const QString &packageID, const QString &summary) {
+        d->pending.insert(packageID, { info, summary });
+    });
+    connect(transaction, &Transaction::errorCode, this, &UpdateTracker::errorCode);
+    connect(transaction, &Transaction::finished, this, [d] (Transaction::Exit status) {
+        d->updatesFinished(status);
+    });
+}
+
+void UpdateTrackerPrivate::updatesFinished(Transaction::Exit status)
+{
+    Q_Q(UpdateTracker);
+
+    if (status != Transaction::ExitSuccess) {
+        pending.clear();
+        finish();
+        return;
+    }
+
+    QStringList removed;
+    for (auto it = updates.constBegin(); it != updates.constEnd(); ++it) {
+        if (!pending.contains(it.key())) {
+            removed.append(it.key());
+        }
+    }
+
+    QStringList added;
+    for (auto it = pending.constBegin(); it != pending.constEnd(); ++it) {
+        if (!updates.contains(it.key())) {
+            added.append(it.key());
+        }
+    }
+
+    const bool countChanged = updates.size() != pending.size();
+    updates.swap(pending);
+    pending.clear();
+
+    if (!removed.isEmpty()) {
+        Q_EMIT q->removed(removed);
+    }
+    if (!added.isEmpty()) {
+        Q_EMIT q->added(added);
+    }
+    if (countChanged) {
+        Q_EMIT q->countChanged();
+    }
+
+    // Known before, so never in added
+    QStringList withoutDetails = added;
+    for (auto it = missingDetails.begin(); it != missingDetails.end();) {
+        if (updates.contains(*it)) {
+            withoutDetails.append(*it);
+            ++it;
+        } else {
+            it = missingDetails.erase(it);
+        }
+    }
+
+    if (fetchDetails && !withoutDetails.isEmpty()) {
+        requestDetails(withoutDetails);
+    } else {
+        finish();
+    }
+}
+
+void UpdateTrackerPrivate::requestDetails(const QStringList &packageIDs)
+{
+    Q_Q(UpdateTracker);
+
+    // Removed again as the details arrive, a failed query leaves them in
+    for (const QString &packageID : packageIDs) {
+        missingDetails.insert(packageID);
+    }
+
+    Transaction *transaction = Daemon::getUpdatesDetails(packageIDs);
+    q->connect(transaction, &Transaction::updateDetails, q, [this] (const QList<UpdateDetail> &details) {
+        Q_Q(UpdateTracker);
+        for (const UpdateDetail &detail : details) {
+            missingDetails.remove(detail.packageId());
+        }
+        Q_EMIT q->updateDetails(details);
+
+        // The per-package signal parses the dates right away, skip it when unused
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&UpdateTracker::updateDetail))) {
+            for (const UpdateDetail &detail : details) {
+                Q_EMIT q->updateDetail(detail.packageId(),
+                                       detail.updates(),
+                                       detail.obsoletes(),
+                                       detail.vendorUrls(),
+                                       detail.bugzillaUrls(),
+                                       detail.cveUrls(),
+                                       detail.restart(),
+                                       detail.updateText(),
+                                       detail.changelog(),
+                                       detail.state(),
+                                       detail.issued(),
+                                       detail.updated());
+            }
+        }
+    });
+    q->connect(transaction, &Transaction::errorCode, q, &UpdateTracker::errorCode);
+    q->connect(transaction, &Transaction::finished, q, [this] {
+        finish();
+    });
+}
+
+void UpdateTrackerPrivate::finish()
+{
+    Q_Q(UpdateTracker);
+
+    busy = false;
+    Q_EMIT q->busyChanged();
+    Q_EMIT q->refreshed();
+
+    if (refreshQueued) {
+        refreshQueued = false;
+        q->refresh();
+    }
+}
+
+#include "moc_updatetracker.cpp"
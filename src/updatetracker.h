@@ -0,0 +1,157 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_UPDATE_TRACKER_H
+#define PACKAGEKIT_UPDATE_TRACKER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+#include <packagekitqt_global.h>
+
+#include "transaction.h"
+#include "updatedetail.h"
+
+namespace PackageKit {
+
+/**
+ * \class UpdateTracker updatetracker.h UpdateTracker
+ *
+ * \brief Keeps the list of available updates current
+ *
+ * The tracker asks for the updates once it is created and again each time
+ * Daemon::updatesChanged() is emitted. Instead of handing out the whole list
+ * on every change it compares the new result with the previous one and only
+ * reports what was added or removed. Update details are only requested for
+ * packages that were not known before, and again on the next refresh for
+ * those whose details could not be fetched.
+ *
+ * If the daemon signals a change while a query is running, a single new
+ * query is started once the current one finished.
+ */
+class UpdateTrackerPrivate;
+class PACKAGEKITQT_LIBRARY UpdateTracker : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool busy READ isBusy NOTIFY busyChanged)
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(bool fetchDetails READ fetchDetails WRITE setFetchDetails)
+public:
+    /**
+     * Creates a tracker for the updates matching \p filters
+     */
+    explicit UpdateTracker(Transaction::Filters filters = Transaction::FilterNone, QObject *parent = nullptr);
+    ~UpdateTracker() override;
+
+    Transaction::Filters filters() const;
+
+    /**
+     * Returns the package IDs of all updates currently known
+     */
+    QStringList packageIds() const;
+
+    bool contains(const QString &packageID) const;
+
+    /**
+     * Returns the update severity of \p packageID as given by the Transaction::package() signal
+     */
+    Transaction::Info info(const QString &packageID) const;
+
+    QString summary(const QString &packageID) const;
+
+    int count() const;
+
+    /**
+     * Returns true while the updates or their details are being queried
+     */
+    bool isBusy() const;
+
+    /**
+     * Whether update details are requested for new updates, defaults to true
+     * \sa updateDetail()
+     */
+    bool fetchDetails() const;
+    void setFetchDetails(bool fetch);
+
+public Q_SLOTS:
+    /**
+     * Queries the updates again, there is usually no need to call this
+     * as the tracker follows Daemon::updatesChanged()
+     */
+    void refresh();
+
+Q_SIGNALS:
+    /**
+     * Emitted with the packages that became available as updates
+     */
+    void added(const QStringList &packageIDs);
+
+    /**
+     * Emitted with the packages that are no longer updates
+     */
+    void removed(const QStringList &packageIDs);
+
+    /**
+     * Emitted with the details of the packages reported by added(), in
+     * batches, when fetchDetails() is set
+     * \sa Transaction::updateDetails()
+     */
+    void updateDetails(const QList<PackageKit::UpdateDetail> &details);
+
+    /**
+     * Emitted for each package reported by added(), when fetchDetails() is set
+     * \sa Transaction::updateDetail()
+     */
+    void updateDetail(const QString &packageID,
+                      const QStringList &updates,
+                      const QStringList &obsoletes,
+                      const QStringList &vendorUrls,
+                      const QStringList &bugzillaUrls,
+                      const QStringList &cveUrls,
+                      PackageKit::Transaction::Restart restart,
+                      const QString &updateText,
+                      const QString &changelog,
+                      PackageKit::Transaction::UpdateState state,
+                      const QDateTime &issued,
+                      const QDateTime &updated);
+
+    /**
+     * Emitted when a query could not be completed, the
+     * current list of updates is kept in this case
+     */
+    void errorCode(PackageKit::Transaction::Error error, const QString &details);
+
+    /**
+     * Emitted once a refresh, including the update details, is complete
+     */
+    void refreshed();
+
+    void busyChanged();
+
+    void countChanged();
+
+private:
+    Q_DECLARE_PRIVATE(UpdateTracker)
+    UpdateTrackerPrivate * const d_ptr;
+};
+
+} // End namespace PackageKit
+
+#endif
@@ -0,0 +1,417 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "versioncompare.h"
+
+#include "daemon.h"
+#include "transaction.h"
+
+#include <algorithm>
+
+using namespace PackageKit;
+
+namespace {
+
+// Byte values used in sort keys, the order of these is what
+// makes the keys compare like the versions do
+constexpr char KeyTilde = 0x01;
+constexpr char KeyEnd = 0x02;
+constexpr char KeyCaret = 0x03;
+constexpr char KeyAlpha = 0x04;
+constexpr char KeyNumber = 0x05;
+
+inline bool isAsciiDigit(QChar c)
+{
+    return c.unicode() >= u'0' && c.unicode() <= u'9';
+}
+
+inline bool isAsciiAlpha(QChar c)
+{
+    const char16_t u = c.unicode();
+    return (u >= u'a' && u <= u'z') || (u >= u'A' && u <= u'Z');
+}
+
+inline bool isRpmSeparator(QChar c)
+{
+    return !isAsciiDigit(c) && !isAsciiAlpha(c) && c != u'~' && c != u'^';
+}
+
+struct Evr {
+    QStringView epoch;
+    QStringView version;
+    QStringView release;
+};
+
+Evr splitEvr(QStringView evr)
+{
+    Evr ret;
+    const qsizetype colon = evr.indexOf(u':');
+    if (colon > 0) {
+        const QStringView epoch = evr.first(colon);
+        if (std::all_of(epoch.begin(), epoch.end(), isAsciiDigit)) {
+            ret.epoch = epoch;
+            evr = evr.sliced(colon + 1);
+        }
+    }
+
+    const qsizetype dash = evr.lastIndexOf(u'-');
+    if (dash == -1) {
+        ret.version = evr;
+    } else {
+        ret.version = evr.first(dash);
+        ret.release = evr.sliced(dash + 1);
+    }
+    return ret;
+}
+
+QStringView stripLeadingZeros(QStringView digits)
+{
+    qsizetype i = 0;
+    while (i < digits.size() && digits[i] == u'0') {
+        ++i;
+    }
+    return digits.sliced(i);
+}
+
+int compareNumbers(QStringView a, QStringView b)
+{
+    a = stripLeadingZeros(a);
+    b = stripLeadingZeros(b);
+    if (a.size() != b.size()) {
+        return a.size() < b.size() ? -1 : 1;
+    }
+    const int rc = a.compare(b);
+    return rc < 0 ? -1 : (rc > 0 ? 1 : 0);
+}
+
+int dpkgOrder(QStringView s, qsizetype i)
+{
+    if (i >= s.size() || isAsciiDigit(s[i])) {
+        return 0;
+    }
+    if (isAsciiAlpha(s[i])) {
+        return s[i].unicode();
+    }
+    if (s[i] == u'~') {
+        return -1;
+    }
+    return s[i].unicode() + 256;
+}
+
+void appendNumberKey(QByteArray &key, QStringView digits)
+{
+    digits = stripLeadingZeros(digits);
+    // Longer numbers are bigger, so the length goes first
+    if (digits.size() < 0xFF) {
+        key.append(char(digits.size()));
+    } else {
+        const auto size = quint16(qMin<qsizetype>(digits.size(), 0xFFFF));
+        key.append(char(0xFF));
+        key.append(char(size >> 8));
+        key.append(char(size & 0xFF));
+    }
+    for (QChar c : digits) {
+        key.append(char(c.unicode()));
+    }
+}
+
+void appendRpmKey(QByteArray &key, QStringView s)
+{
+    const qsizetype size = s.size();
+    qsizetype i = 0;
+    for (;;) {
+        while (i < size && isRpmSeparator(s[i])) {
+            ++i;
+        }
+        if (i == size) {
+            key.append(KeyEnd);
+            return;
+        }
+
+        const qsizetype start = i;
+        if (s[i] == u'~') {
+            key.append(KeyTilde);
+            ++i;
+        } else if (s[i] == u'^') {
+            key.append(KeyCaret);
+            ++i;
+        } else if (isAsciiDigit(s[i])) {
+            while (i < size && isAsciiDigit(s[i])) {
+                ++i;
+            }
+            key.append(KeyNumber);
+            appendNumberKey(key, s.sliced(start, i - start));
+        } else {
+            while (i < size && isAsciiAlpha(s[i])) {
+                ++i;
+            }
+            key.append(KeyAlpha);
+            for (qsizetype c = start; c < i; ++c) {
+                key.append(char(s[c].unicode()));
+            }
+            key.append('\0');
+        }
+    }
+}
+
+void appendDpkgKey(QByteArray &key, QStringView s)
+{
+    const qsizetype size = s.size();
+    qsizetype i = 0;
+    do {
+        for (; i < size && !isAsciiDigit(s[i]); ++i) {
+            const char16_t c = s[i].unicode();
+            if (c == u'~') {
+                key.append(KeyTilde);
+            } else if (isAsciiAlpha(s[i])) {
+                key.append(char(c));
+            } else if (c < 0x7F) {
+                key.append(char(0x80 + c));
+            } else {
+                key.append(char(0xFF));
+                key.append(char(c >> 8));
+                key.append(char(c & 0xFF));
+            }
+        }
+        key.append(KeyEnd);
+
+        const qsizetype start = i;
+        while (i < size && isAsciiDigit(s[i])) {
+            ++i;
+        }
+        appendNumberKey(key, s.sliced(start, i - start));
+    } while (i < size);
+    key.append(KeyEnd);
+}
+
+} // namespace
+
+VersionCompare::Scheme VersionCompare::schemeFor(const QString &backendName, const QString &distroId)
+{
+    if (backendName == QLatin1String("apt") ||
+        backendName == QLatin1String("aptcc") ||
+        backendName == QLatin1String("opkg")) {
+        return SchemeDpkg;
+    }
+
+    if (backendName.isEmpty() || backendName == QLatin1String("dummy")) {
+        // distroId is "distro;version;arch"
+        const QStringView distro = QStringView(distroId).left(distroId.indexOf(QLatin1Char(';')));
+        if (distro == QLatin1String("debian") ||
+            distro == QLatin1String("ubuntu") ||
+            distro == QLatin1String("linuxmint") ||
+            distro == QLatin1String("pop") ||
+            distro == QLatin1String("raspbian")) {
+            return SchemeDpkg;
+        }
+    }
+
+    return SchemeRpm;
+}
+
+VersionCompare::Scheme VersionCompare::systemScheme()
+{
+    return schemeFor(Daemon::backendName(), Daemon::distroID());
+}
+
+int VersionCompare::compare(QStringView a, QStringView b, Scheme scheme)
+{
+    const Evr evrA = splitEvr(a);
+    const Evr evrB = splitEvr(b);
+
+    int rc = compareNumbers(evrA.epoch, evrB.epoch);
+    if (rc != 0) {
+        return rc;
+    }
+
+    const auto compareSegment = scheme == SchemeDpkg ? &VersionCompare::dpkgvercmp
+                                                     : &VersionCompare::rpmvercmp;
+    rc = compareSegment(evrA.version, evrB.version);
+    if (rc != 0) {
+        return rc;
+    }
+    return compareSegment(evrA.release, evrB.release);
+}
+
+int VersionCompare::comparePackageIds(const QString &packageIdA, const QString &packageIdB, Scheme scheme)
+{
+    return compare(Transaction::packageVersion(packageIdA),
+                   Transaction::packageVersion(packageIdB),
+                   scheme);
+}
+
+int VersionCompare::rpmvercmp(QStringView a, QStringView b)
+{
+    if (a == b) {
+        return 0;
+    }
+
+    const qsizetype sizeA = a.size();
+    const qsizetype sizeB = b.size();
+    qsizetype i = 0;
+    qsizetype j = 0;
+    while (i < sizeA || j < sizeB) {
+        while (i < sizeA && isRpmSeparator(a[i])) {
+            ++i;
+        }
+        while (j < sizeB && isRpmSeparator(b[j])) {
+            ++j;
+        }
+
+        const QChar ca = i < sizeA ? a[i] : QChar();
+        const QChar cb = j < sizeB ? b[j] : QChar();
+
+        // A tilde sorts before everything else, even the end of the string
+        if (ca == u'~' || cb == u'~') {
+            if (ca != u'~') {
+                return 1;
+            }
+            if (cb != u'~') {
+                return -1;
+            }
+            ++i;
+            ++j;
+            continue;
+        }
+
+        // A caret sorts after the end of the string but before anything else
+        if (ca == u'^' || cb == u'^') {
+            if (i == sizeA) {
+                return -1;
+            }
+            if (j == sizeB) {
+                return 1;
+            }
+            if (ca != u'^') {
+                return 1;
+            }
+            if (cb != u'^') {
+                return -1;
+            }
+            ++i;
+            ++j;
+            continue;
+        }
+
+        if (i == sizeA || j == sizeB) {
+            break;
+        }
+
+        const qsizetype startA = i;
+        const qsizetype startB = j;
+        const bool isNumber = isAsciiDigit(ca);
+        if (isNumber) {
+            while (i < sizeA && isAsciiDigit(a[i])) {
+                ++i;
+            }
+            while (j < sizeB && isAsciiDigit(b[j])) {
+                ++j;
+            }
+        } else {
+            while (i < sizeA && isAsciiAlpha(a[i])) {
+                ++i;
+            }
+            while (j < sizeB && isAsciiAlpha(b[j])) {
+                ++j;
+            }
+        }
+
+        // Segments of different types, numeric ones are newer
+        if (j == startB) {
+            return isNumber ? 1 : -1;
+        }
+
+        const QStringView segmentA = a.sliced(startA, i - startA);
+        const QStringView segmentB = b.sliced(startB, j - startB);
+        const int rc = isNumber ? compareNumbers(segmentA, segmentB) : segmentA.compare(segmentB);
+        if (rc != 0) {
+            return rc < 0 ? -1 : 1;
+        }
+    }
+
+    if (i == sizeA && j == sizeB) {
+        return 0;
+    }
+    // Whichever still has segments left is newer
+    return i == sizeA ? -1 : 1;
+}
+
+int VersionCompare::dpkgvercmp(QStringView a, QStringView b)
+{
+    const qsizetype sizeA = a.size();
+    const qsizetype sizeB = b.size();
+    qsizetype i = 0;
+    qsizetype j = 0;
+    while (i < sizeA || j < sizeB) {
+        int firstDiff = 0;
+
+        while ((i < sizeA && !isAsciiDigit(a[i])) || (j < sizeB && !isAsciiDigit(b[j]))) {
+            const int orderA = dpkgOrder(a, i);
+            const int orderB = dpkgOrder(b, j);
+            if (orderA != orderB) {
+                return orderA < orderB ? -1 : 1;
+            }
+            ++i;
+            ++j;
+        }
+
+        while (i < sizeA && a[i] == u'0') {
+            ++i;
+        }
+        while (j < sizeB && b[j] == u'0') {
+            ++j;
+        }
+        while (i < sizeA && j < sizeB && isAsciiDigit(a[i]) && isAsciiDigit(b[j])) {
+            if (!firstDiff) {
+                firstDiff = a[i].unicode() - b[j].unicode();
+            }
+            ++i;
+            ++j;
+        }
+
+        if (i < sizeA && isAsciiDigit(a[i])) {
+            return 1;
+        }
+        if (j < sizeB && isAsciiDigit(b[j])) {
+            return -1;
+        }
+        if (firstDiff) {
+            return firstDiff < 0 ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+QByteArray VersionCompare::sortKey(QStringView version, Scheme scheme)
+{
+    const Evr evr = splitEvr(version);
+
+    QByteArray key;
+    key.reserve(version.size() + 8);
+    appendNumberKey(key, evr.epoch);
+    if (scheme == SchemeDpkg) {
+        appendDpkgKey(key, evr.version);
+        appendDpkgKey(key, evr.release);
+    } else {
+        appendRpmKey(key, evr.version);
+        appendRpmKey(key, evr.release);
+    }
+    return key;
+}
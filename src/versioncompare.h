@@ -0,0 +1,107 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PACKAGEKIT_VERSION_COMPARE_H
+#define PACKAGEKIT_VERSION_COMPARE_H
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QStringView>
+
+#include <packagekitqt_global.h>
+
+namespace PackageKit {
+
+/**
+ * \class VersionCompare versioncompare.h VersionCompare
+ *
+ * \brief Compares package versions the way the native package manager does
+ *
+ * PackageKit hands out versions as opaque strings, see Transaction::packageVersion().
+ * This class orders them with the same rules rpm (rpmvercmp) or dpkg use, which
+ * is needed to find the newest of several versions or to tell an upgrade from
+ * a downgrade.
+ *
+ * Versions are expected in the "[epoch:]version[-release]" form both package
+ * managers use; a missing epoch is 0 and a missing release is empty.
+ *
+ * When many versions have to be sorted, use sortKey() once per version and
+ * compare the keys with memcmp() (or QByteArray's operators), the keys order
+ * exactly as compare() does.
+ */
+class PACKAGEKITQT_LIBRARY VersionCompare
+{
+public:
+    /**
+     * Describes the version ordering rules to use
+     */
+    enum Scheme {
+        SchemeRpm,  /** < rpmvercmp, used by dnf, zypp, alpm and most other backends */
+        SchemeDpkg  /** < dpkg --compare-versions, used by apt */
+    };
+
+    /**
+     * Returns the scheme matching the PackageKit \p backendName,
+     * using \p distroId as a hint when the backend is not known
+     */
+    static Scheme schemeFor(const QString &backendName, const QString &distroId = QString());
+
+    /**
+     * Returns the scheme matching Daemon::backendName() and Daemon::distroID()
+     */
+    static Scheme systemScheme();
+
+    /**
+     * Compares the two full versions \p a and \p b
+     * \return a negative value if \p a is older, 0 if both are equal and
+     * a positive value if \p a is newer than \p b
+     */
+    static int compare(QStringView a, QStringView b, Scheme scheme);
+
+    /**
+     * Convenience function comparing the version part of two package IDs
+     * \sa Transaction::packageVersion()
+     */
+    static int comparePackageIds(const QString &packageIdA, const QString &packageIdB, Scheme scheme);
+
+    /**
+     * Compares a single version segment (no epoch or release handling)
+     * following rpm's rpmvercmp()
+     */
+    static int rpmvercmp(QStringView a, QStringView b);
+
+    /**
+     * Compares a single version segment (no epoch or revision handling)
+     * following dpkg's verrevcmp()
+     */
+    static int dpkgvercmp(QStringView a, QStringView b);
+
+    /**
+     * Returns a binary key for \p version such that comparing two keys
+     * byte-wise gives the same result as compare() on the versions.
+     *
+     * Keys of different schemes must not be compared with each other.
+     */
+    static QByteArray sortKey(QStringView version, Scheme scheme);
+};
+
+} // End namespace PackageKit
+
+#endif
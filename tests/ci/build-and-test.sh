@@ -8,13 +8,16 @@ set -x
 
 cmake -S . -B build -GNinja \
   -DMAINTAINER:BOOL=ON \
+  -DBUILD_BENCHMARKS:BOOL=ON \
+  -DBUILD_TOOLS:BOOL=ON \
+  -DBUILD_QML:BOOL=ON \
+  -DTRACING:BOOL=ON \
   $@
 
 # Build, Test & Install
 cmake --build build
 
-## No tests yet
-#cd build && ctest && cd -
+ctest --test-dir build --output-on-failure
 
 DUMMY_DESTDIR=/tmp/install-root/
 rm -rf $DUMMY_DESTDIR
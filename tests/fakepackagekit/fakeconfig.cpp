@@ -0,0 +1,132 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "fakeconfig.h"
+
+#include <limits>
+
+namespace {
+
+const QLatin1String NamePrefix("fake-package-");
+
+template <typename T>
+bool read(const QVariantMap &values, const char *key, T &field)
+{
+    const auto it = values.constFind(QLatin1String(key));
+    if (it == values.constEnd()) {
+        return false;
+    }
+    field = qvariant_cast<T>(*it);
+    return true;
+}
+
+}
+
+QStringList FakeConfig::update(const QVariantMap &values)
+{
+    int known = 0;
+    known += read(values, "packages", packages);
+    known += read(values, "updates", updates);
+    known += read(values, "filesPerPackage", filesPerPackage);
+    known += read(values, "oldTransactions", oldTransactions);
+    known += read(values, "progressUpdates", progressUpdates);
+    known += read(values, "progressRate", progressRate);
+    known += read(values, "chunkSize", chunkSize);
+    known += read(values, "pluralSignals", pluralSignals);
+    known += read(values, "failingRole", failingRole);
+
+    QStringList unknown;
+    if (known != values.size()) {
+        const QVariantMap all = toVariantMap();
+        for (auto it = values.constBegin(); it != values.constEnd(); ++it) {
+            if (!all.contains(it.key())) {
+                unknown.append(it.key());
+            }
+        }
+    }
+    return unknown;
+}
+
+QVariantMap FakeConfig::toVariantMap() const
+{
+    return {
+        { QStringLiteral("packages"), packages },
+        { QStringLiteral("updates"), updates },
+        { QStringLiteral("filesPerPackage"), filesPerPackage },
+        { QStringLiteral("oldTransactions"), oldTransactions },
+        { QStringLiteral("progressUpdates"), progressUpdates },
+        { QStringLiteral("progressRate"), progressRate },
+        { QStringLiteral("chunkSize"), chunkSize },
+        { QStringLiteral("pluralSignals"), pluralSignals },
+        { QStringLiteral("failingRole"), failingRole },
+    };
+}
+
+QString FakeConfig::packageName(uint index)
+{
+    return NamePrefix + QString::number(index).rightJustified(6, QLatin1Char('0'));
+}
+
+QString FakeConfig::packageId(uint index)
+{
+    return packageName(index)
+            + (isInstalled(index) ? QLatin1String(";1.0-1;x86_64;installed")
+                                  : QLatin1String(";1.0-1;x86_64;fake-repo"));
+}
+
+QString FakeConfig::updateId(uint index)
+{
+    return packageName(index) + QLatin1String(";1.1-1;x86_64;fake-repo");
+}
+
+QString FakeConfig::summary(uint index)
+{
+    return QLatin1String("Summary of fake package ") + QString::number(index);
+}
+
+bool FakeConfig::isInstalled(uint index)
+{
+    return index % 2 == 0;
+}
+
+int FakeConfig::indexOfName(const QString &name)
+{
+    if (!name.startsWith(NamePrefix)) {
+        return -1;
+    }
+    bool ok;
+    const uint index = QStringView(name).mid(NamePrefix.size()).toUInt(&ok);
+    return ok && index <= uint(std::numeric_limits<int>::max()) ? int(index) : -1;
+}
+
+int FakeConfig::indexOfPackageId(const QString &packageId)
+{
+    return indexOfName(packageId.section(QLatin1Char(';'), 0, 0));
+}
+
+QString FakeConfig::fileName(uint index, uint file)
+{
+    return QLatin1String("/usr/share/") + packageName(index) + QLatin1String("/file-") + QString::number(file);
+}
+
+QString FakeConfig::oldTransactionTid(uint index)
+{
+    return QLatin1String("/fake_old_") + QString::number(index);
+}
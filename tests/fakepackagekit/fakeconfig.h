@@ -0,0 +1,85 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef FAKE_CONFIG_H
+#define FAKE_CONFIG_H
+
+#include <QString>
+#include <QStringList>
+#include <QVariantMap>
+
+/**
+ * What the fake daemon sends back, shared by the daemon itself and
+ * the test harness so tests can compute the expected results.
+ *
+ * Packages are numbered from 0 to packages - 1, even ones are installed.
+ * The first \c updates packages have an update available.
+ */
+class FakeConfig
+{
+public:
+    uint packages = 100;
+    uint updates = 10;
+    uint filesPerPackage = 3;
+    uint oldTransactions = 10;
+
+    // PropertiesChanged signals sent before the results, at progressRate per
+    // second or as fast as possible when 0
+    uint progressUpdates = 0;
+    uint progressRate = 0;
+
+    // Results sent per main loop iteration (and per plural signal), 0 sends everything at once
+    uint chunkSize = 0;
+
+    // Use Packages and UpdateDetails when the client asks for them, like PackageKit does,
+    // and FileLists, which PackageKit doesn't have, to test the speculative path in Transaction
+    bool pluralSignals = true;
+
+    // Transactions of this Transaction::Role fail instead of sending results, 0 for none
+    uint failingRole = 0;
+
+    /**
+     * Sets the values found in \p values, keyed by the member names.
+     * Returns the keys that are not known.
+     */
+    QStringList update(const QVariantMap &values);
+    QVariantMap toVariantMap() const;
+
+    static QString packageName(uint index);
+    static QString packageId(uint index);
+    static QString updateId(uint index);
+    static QString summary(uint index);
+    static bool isInstalled(uint index);
+
+    /**
+     * Returns the index of the package called \p name, or -1
+     */
+    static int indexOfName(const QString &name);
+
+    /**
+     * Returns the index of the package (or update) \p packageId refers to, or -1
+     */
+    static int indexOfPackageId(const QString &packageId);
+
+    static QString fileName(uint index, uint file);
+    static QString oldTransactionTid(uint index);
+};
+
+#endif
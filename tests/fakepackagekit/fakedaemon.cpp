@@ -0,0 +1,250 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "fakedaemon.h"
+#include "faketransaction.h"
+
+#include <QCoreApplication>
+#include <QDBusMessage>
+#include <QDebug>
+#include <QTimer>
+
+#include <daemon.h>
+
+using namespace PackageKit;
+
+namespace {
+
+const QString PkName = QStringLiteral("org.freedesktop.PackageKit");
+const QString PkPath = QStringLiteral("/org/freedesktop/PackageKit");
+const QString ControlPath = QStringLiteral("/fake");
+
+constexpr QDBusConnection::RegisterOptions ExportOptions = QDBusConnection::ExportAllSlots
+                                                         | QDBusConnection::ExportAllSignals
+                                                         | QDBusConnection::ExportAllProperties;
+
+qulonglong bit(int value)
+{
+    return qulonglong(1) << value;
+}
+
+}
+
+FakeDaemon::FakeDaemon(const QDBusConnection &connection, const FakeConfig &config, QObject *parent)
+    : QObject(parent)
+    , m_connection(connection)
+    , m_config(config)
+    , m_filters(Transaction::FilterNone | Transaction::FilterInstalled | Transaction::FilterNotInstalled)
+    , m_networkState(Daemon::NetworkOnline)
+    , m_roles(bit(Transaction::RoleGetPackages)
+              | bit(Transaction::RoleGetUpdates)
+              | bit(Transaction::RoleGetUpdateDetail)
+              | bit(Transaction::RoleResolve)
+              | bit(Transaction::RoleSearchName)
+              | bit(Transaction::RoleGetDetails)
+              | bit(Transaction::RoleGetFiles)
+              | bit(Transaction::RoleGetOldTransactions))
+{
+    qDBusRegisterMetaType<FakePackage>();
+    qDBusRegisterMetaType<QList<FakePackage>>();
+    qDBusRegisterMetaType<FakeUpdateDetail>();
+    qDBusRegisterMetaType<QList<FakeUpdateDetail>>();
+    qDBusRegisterMetaType<FakeFiles>();
+    qDBusRegisterMetaType<QList<FakeFiles>>();
+}
+
+bool FakeDaemon::registerOnBus()
+{
+    if (!m_connection.registerObject(PkPath, this, ExportOptions)) {
+        qWarning() << "Failed to export the daemon:" << m_connection.lastError().message();
+        return false;
+    }
+
+    auto control = new FakeControl(this);
+    if (!m_connection.registerObject(ControlPath, control, QDBusConnection::ExportAllSlots)) {
+        qWarning() << "Failed to export the control object:" << m_connection.lastError().message();
+        return false;
+    }
+
+    if (!m_connection.registerService(PkName)) {
+        qWarning() << "Failed to take the PackageKit name:" << m_connection.lastError().message();
+        return false;
+    }
+    return true;
+}
+
+QDBusConnection FakeDaemon::connection() const
+{
+    return m_connection;
+}
+
+FakeConfig FakeDaemon::config() const
+{
+    return m_config;
+}
+
+QStringList FakeDaemon::configure(const QVariantMap &values)
+{
+    return m_config.update(values);
+}
+
+bool FakeDaemon::setDaemonProperty(const QString &name, const QVariant &value)
+{
+    const QByteArray key = name.toLatin1();
+    if (metaObject()->indexOfProperty(key.constData()) < 0 || !setProperty(key.constData(), value)) {
+        return false;
+    }
+
+    sendPropertiesChanged(m_connection, PkPath, PkName, { { name, property(key.constData()) } });
+    return true;
+}
+
+QStringList FakeDaemon::transactionList() const
+{
+    return m_transactions.keys();
+}
+
+void FakeDaemon::removeTransaction(FakeTransaction *transaction)
+{
+    m_connection.unregisterObject(transaction->path());
+    m_transactions.remove(transaction->path());
+    transaction->deleteLater();
+
+    Q_EMIT TransactionListChanged(transactionList());
+}
+
+void FakeDaemon::emitUpdatesChanged()
+{
+    Q_EMIT UpdatesChanged();
+}
+
+void FakeDaemon::emitRepoListChanged()
+{
+    Q_EMIT RepoListChanged();
+}
+
+void FakeDaemon::sendPropertiesChanged(const QDBusConnection &connection,
+                                       const QString &path,
+                                       const QString &interface,
+                                       const QVariantMap &properties)
+{
+    QDBusMessage message = QDBusMessage::createSignal(path,
+                                                      QStringLiteral("org.freedesktop.DBus.Properties"),
+                                                      QStringLiteral("PropertiesChanged"));
+    message << interface << properties << QStringList();
+    connection.send(message);
+}
+
+QDBusObjectPath FakeDaemon::CreateTransaction()
+{
+    const QString path = QLatin1Char('/') + QString::number(++m_lastTransaction) + QLatin1String("_fake");
+
+    auto transaction = new FakeTransaction(this, path);
+    if (!m_connection.registerObject(path, transaction, ExportOptions)) {
+        delete transaction;
+        sendErrorReply(QDBusError::Failed, QStringLiteral("Failed to export the transaction"));
+        return QDBusObjectPath();
+    }
+    m_transactions.insert(path, transaction);
+
+    Q_EMIT TransactionListChanged(transactionList());
+    return QDBusObjectPath(path);
+}
+
+QStringList FakeDaemon::GetTransactionList()
+{
+    return transactionList();
+}
+
+uint FakeDaemon::GetTimeSinceAction(uint role)
+{
+    Q_UNUSED(role)
+    return 60;
+}
+
+QString FakeDaemon::GetDaemonState()
+{
+    return QLatin1String("fake daemon with ") + QString::number(m_transactions.size()) + QLatin1String(" transactions");
+}
+
+uint FakeDaemon::CanAuthorize(const QString &actionId)
+{
+    Q_UNUSED(actionId)
+    return Daemon::AuthorizeYes;
+}
+
+void FakeDaemon::StateHasChanged(const QString &reason)
+{
+    Q_UNUSED(reason)
+}
+
+void FakeDaemon::SuggestDaemonQuit()
+{
+}
+
+FakeControl::FakeControl(FakeDaemon *daemon)
+    : QObject(daemon)
+    , m_daemon(daemon)
+{
+}
+
+void FakeControl::Configure(const QVariantMap &values)
+{
+    const QStringList unknown = m_daemon->configure(values);
+    if (!unknown.isEmpty()) {
+        sendErrorReply(QDBusError::InvalidArgs,
+                       QLatin1String("Unknown settings: ") + unknown.join(QLatin1String(", ")));
+    }
+}
+
+QVariantMap FakeControl::Configuration()
+{
+    return m_daemon->config().toVariantMap();
+}
+
+void FakeControl::SetDaemonProperty(const QString &name, const QDBusVariant &value)
+{
+    if (!m_daemon->setDaemonProperty(name, value.variant())) {
+        sendErrorReply(QDBusError::InvalidArgs, QLatin1String("Cannot set property ") + name);
+    }
+}
+
+void FakeControl::EmitUpdatesChanged()
+{
+    m_daemon->emitUpdatesChanged();
+}
+
+void FakeControl::EmitRepoListChanged()
+{
+    m_daemon->emitRepoListChanged();
+}
+
+uint FakeControl::TransactionCount()
+{
+    return m_daemon->transactionList().size();
+}
+
+void FakeControl::Quit()
+{
+    // Reply first, then drop the name like a daemon exiting would
+    QTimer::singleShot(0, qApp, &QCoreApplication::quit);
+}
+
+#include "moc_fakedaemon.cpp"
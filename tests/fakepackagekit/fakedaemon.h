@@ -0,0 +1,148 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef FAKE_DAEMON_H
+#define FAKE_DAEMON_H
+
+#include <QDBusConnection>
+#include <QDBusContext>
+#include <QDBusObjectPath>
+#include <QDBusVariant>
+#include <QHash>
+#include <QObject>
+
+#include "fakeconfig.h"
+
+class FakeTransaction;
+
+/**
+ * The org.freedesktop.PackageKit object of the fake daemon
+ *
+ * Properties are writable through the control object so tests
+ * can check how the library follows PropertiesChanged.
+ */
+class FakeDaemon : public QObject, protected QDBusContext
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.freedesktop.PackageKit")
+    Q_PROPERTY(QString BackendAuthor MEMBER m_backendAuthor)
+    Q_PROPERTY(QString BackendDescription MEMBER m_backendDescription)
+    Q_PROPERTY(QString BackendName MEMBER m_backendName)
+    Q_PROPERTY(QString DistroId MEMBER m_distroId)
+    Q_PROPERTY(qulonglong Filters MEMBER m_filters)
+    Q_PROPERTY(qulonglong Groups MEMBER m_groups)
+    Q_PROPERTY(bool Locked MEMBER m_locked)
+    Q_PROPERTY(QStringList MimeTypes MEMBER m_mimeTypes)
+    Q_PROPERTY(uint NetworkState MEMBER m_networkState)
+    Q_PROPERTY(qulonglong Roles MEMBER m_roles)
+    Q_PROPERTY(uint VersionMajor MEMBER m_versionMajor)
+    Q_PROPERTY(uint VersionMinor MEMBER m_versionMinor)
+    Q_PROPERTY(uint VersionMicro MEMBER m_versionMicro)
+public:
+    FakeDaemon(const QDBusConnection &connection, const FakeConfig &config, QObject *parent = nullptr);
+
+    /**
+     * Exports the daemon and the control object, then takes the
+     * org.freedesktop.PackageKit name
+     */
+    bool registerOnBus();
+
+    QDBusConnection connection() const;
+
+    FakeConfig config() const;
+    QStringList configure(const QVariantMap &values);
+
+    /**
+     * Sets the property \p name and tells the clients about it
+     */
+    bool setDaemonProperty(const QString &name, const QVariant &value);
+
+    QStringList transactionList() const;
+    void removeTransaction(FakeTransaction *transaction);
+
+    void emitUpdatesChanged();
+    void emitRepoListChanged();
+
+    static void sendPropertiesChanged(const QDBusConnection &connection,
+                                      const QString &path,
+                                      const QString &interface,
+                                      const QVariantMap &properties);
+
+public Q_SLOTS:
+    QDBusObjectPath CreateTransaction();
+    QStringList GetTransactionList();
+    uint GetTimeSinceAction(uint role);
+    QString GetDaemonState();
+    uint CanAuthorize(const QString &actionId);
+    void StateHasChanged(const QString &reason);
+    void SuggestDaemonQuit();
+
+Q_SIGNALS:
+    void TransactionListChanged(const QStringList &transactions);
+    void RestartSchedule();
+    void RepoListChanged();
+    void UpdatesChanged();
+
+private:
+    QDBusConnection m_connection;
+    FakeConfig m_config;
+    QHash<QString, FakeTransaction *> m_transactions;
+    uint m_lastTransaction = 0;
+
+    QString m_backendAuthor = QStringLiteral("PackageKit-Qt contributors");
+    QString m_backendDescription = QStringLiteral("Fake backend for tests and benchmarks");
+    QString m_backendName = QStringLiteral("fake");
+    QString m_distroId = QStringLiteral("fake;1.0;x86_64");
+    qulonglong m_filters;
+    qulonglong m_groups = 0;
+    bool m_locked = false;
+    QStringList m_mimeTypes;
+    uint m_networkState;
+    qulonglong m_roles;
+    uint m_versionMajor = 1;
+    uint m_versionMinor = 3;
+    uint m_versionMicro = 0;
+};
+
+/**
+ * The org.freedesktop.PackageKit.Fake interface on /fake, used by the
+ * test harness to change what the daemon sends back
+ */
+class FakeControl : public QObject, protected QDBusContext
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.freedesktop.PackageKit.Fake")
+public:
+    explicit FakeControl(FakeDaemon *daemon);
+
+public Q_SLOTS:
+    void Configure(const QVariantMap &values);
+    QVariantMap Configuration();
+    void SetDaemonProperty(const QString &name, const QDBusVariant &value);
+    void EmitUpdatesChanged();
+    void EmitRepoListChanged();
+    uint TransactionCount();
+    void Quit();
+
+private:
+    FakeDaemon *m_daemon;
+};
+
+#endif
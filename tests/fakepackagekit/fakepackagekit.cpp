@@ -0,0 +1,207 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "fakepackagekit.h"
+
+#include <QDBusConnectionInterface>
+#include <QDBusMessage>
+#include <QDBusVariant>
+#include <QDeadlineTimer>
+#include <QDebug>
+
+#include <daemon.h>
+
+namespace {
+
+const QString PkName = QStringLiteral("org.freedesktop.PackageKit");
+const QString ControlPath = QStringLiteral("/fake");
+const QString ControlInterface = QStringLiteral("org.freedesktop.PackageKit.Fake");
+
+constexpr int StartTimeout = 10000;
+
+}
+
+FakePackageKit::FakePackageKit()
+{
+}
+
+FakePackageKit::~FakePackageKit()
+{
+    stop();
+}
+
+bool FakePackageKit::start(const QVariantMap &config)
+{
+    if (isRunning()) {
+        return config.isEmpty() || configure(config);
+    }
+    m_error.clear();
+
+    // After quit() only the daemon needs to come back
+    if (m_bus.state() == QProcess::NotRunning && !startBus()) {
+        return false;
+    }
+
+    m_daemon.setProgram(QStringLiteral(FAKEPACKAGEKITD));
+    m_daemon.setArguments({ QStringLiteral("--address"), m_address });
+    m_daemon.setProcessChannelMode(QProcess::ForwardedChannels);
+    m_daemon.start();
+    if (!m_daemon.waitForStarted()) {
+        return fail(QLatin1String("Failed to start fakepackagekitd: ") + m_daemon.errorString());
+    }
+
+    const QDBusConnection bus = connection();
+    QDeadlineTimer deadline(StartTimeout);
+    while (!bus.interface()->isServiceRegistered(PkName).value()) {
+        if (m_daemon.waitForFinished(10) || deadline.hasExpired()) {
+            return fail(QStringLiteral("fakepackagekitd did not show up on the bus"));
+        }
+    }
+
+    return config.isEmpty() || configure(config);
+}
+
+void FakePackageKit::stop()
+{
+    if (!m_connectionName.isEmpty()) {
+        QDBusConnection::disconnectFromBus(m_connectionName);
+        QDBusConnection::disconnectFromBus(m_connectionName + QLatin1String("-library"));
+        m_connectionName.clear();
+    }
+
+    for (QProcess *process : { &m_daemon, &m_bus }) {
+        if (process->state() != QProcess::NotRunning) {
+            process->terminate();
+            if (!process->waitForFinished(5000)) {
+                process->kill();
+                process->waitForFinished();
+            }
+        }
+    }
+    m_address.clear();
+}
+
+bool FakePackageKit::isRunning() const
+{
+    return m_daemon.state() == QProcess::Running;
+}
+
+QString FakePackageKit::errorString() const
+{
+    return m_error;
+}
+
+QString FakePackageKit::address() const
+{
+    return m_address;
+}
+
+QDBusConnection FakePackageKit::connection() const
+{
+    return QDBusConnection(m_connectionName);
+}
+
+bool FakePackageKit::configure(const QVariantMap &values)
+{
+    return call(QStringLiteral("Configure"), { values });
+}
+
+bool FakePackageKit::setDaemonProperty(const QString &name, const QVariant &value)
+{
+    return call(QStringLiteral("SetDaemonProperty"), { name, QVariant::fromValue(QDBusVariant(value)) });
+}
+
+bool FakePackageKit::emitUpdatesChanged()
+{
+    return call(QStringLiteral("EmitUpdatesChanged"));
+}
+
+bool FakePackageKit::emitRepoListChanged()
+{
+    return call(QStringLiteral("EmitRepoListChanged"));
+}
+
+uint FakePackageKit::transactionCount()
+{
+    QVariant count;
+    call(QStringLiteral("TransactionCount"), QVariantList(), &count);
+    return count.toUInt();
+}
+
+bool FakePackageKit::quit()
+{
+    return call(QStringLiteral("Quit")) && m_daemon.waitForFinished(StartTimeout);
+}
+
+bool FakePackageKit::startBus()
+{
+    m_bus.setProgram(QStringLiteral(DBUS_DAEMON));
+    m_bus.setArguments({ QStringLiteral("--session"),
+                         QStringLiteral("--nofork"),
+                         QStringLiteral("--nopidfile"),
+                         QStringLiteral("--print-address=1") });
+    m_bus.setReadChannel(QProcess::StandardOutput);
+    m_bus.start();
+    if (!m_bus.waitForStarted()) {
+        return fail(QLatin1String("Failed to start dbus-daemon: ") + m_bus.errorString());
+    }
+    while (!m_bus.canReadLine()) {
+        if (!m_bus.waitForReadyRead(StartTimeout)) {
+            return fail(QStringLiteral("dbus-daemon did not print its address"));
+        }
+    }
+    m_address = QString::fromLocal8Bit(m_bus.readLine()).trimmed();
+
+    m_connectionName = QLatin1String("fakepackagekit-") + QString::number(quintptr(this), 16);
+    const QDBusConnection bus = QDBusConnection::connectToBus(m_address, m_connectionName);
+    if (!bus.isConnected()) {
+        return fail(QLatin1String("Failed to connect to the private bus: ") + bus.lastError().message());
+    }
+
+    // The library gets a connection of its own, like it has with the system bus
+    const QDBusConnection library = QDBusConnection::connectToBus(m_address, m_connectionName + QLatin1String("-library"));
+    if (!library.isConnected()) {
+        return fail(QLatin1String("Failed to connect to the private bus: ") + library.lastError().message());
+    }
+    PackageKit::Daemon::setConnection(library);
+    return true;
+}
+
+bool FakePackageKit::call(const QString &method, const QVariantList &arguments, QVariant *result)
+{
+    QDBusMessage message = QDBusMessage::createMethodCall(PkName, ControlPath, ControlInterface, method);
+    message.setArguments(arguments);
+
+    const QDBusMessage reply = connection().call(message);
+    if (reply.type() != QDBusMessage::ReplyMessage) {
+        return fail(method + QLatin1String(" failed: ") + reply.errorMessage());
+    }
+    if (result && !reply.arguments().isEmpty()) {
+        *result = reply.arguments().constFirst();
+    }
+    return true;
+}
+
+bool FakePackageKit::fail(const QString &error)
+{
+    qWarning() << error;
+    m_error = error;
+    return false;
+}
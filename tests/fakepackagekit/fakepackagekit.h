@@ -0,0 +1,86 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef FAKE_PACKAGEKIT_H
+#define FAKE_PACKAGEKIT_H
+
+#include <QDBusConnection>
+#include <QProcess>
+#include <QVariantMap>
+
+#include "fakeconfig.h"
+
+/**
+ * Runs the fake PackageKit daemon on a private bus
+ *
+ * start() spawns a dbus-daemon with the session configuration, hands a
+ * connection to it to PackageKit::Daemon::setConnection() and starts
+ * fakepackagekitd there. Everything is stopped on destruction.
+ */
+class FakePackageKit
+{
+public:
+    FakePackageKit();
+    ~FakePackageKit();
+
+    bool start(const QVariantMap &config = QVariantMap());
+    void stop();
+
+    bool isRunning() const;
+    QString errorString() const;
+
+    /**
+     * The address of the private bus
+     */
+    QString address() const;
+
+    /**
+     * A connection to the private bus, separate from the library's one
+     */
+    QDBusConnection connection() const;
+
+    /**
+     * Changes the settings of FakeConfig for the transactions created from now on
+     */
+    bool configure(const QVariantMap &values);
+    bool setDaemonProperty(const QString &name, const QVariant &value);
+    bool emitUpdatesChanged();
+    bool emitRepoListChanged();
+    uint transactionCount();
+
+    /**
+     * Makes the daemon exit, as if it crashed. Calling start()
+     * afterwards starts a new one on the same bus.
+     */
+    bool quit();
+
+private:
+    bool startBus();
+    bool call(const QString &method, const QVariantList &arguments = QVariantList(), QVariant *result = nullptr);
+    bool fail(const QString &error);
+
+    QProcess m_bus;
+    QProcess m_daemon;
+    QString m_address;
+    QString m_connectionName;
+    QString m_error;
+};
+
+#endif
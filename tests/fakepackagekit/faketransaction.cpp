@@ -0,0 +1,518 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "faketransaction.h"
+#include "fakedaemon.h"
+
+#include <QDateTime>
+#include <QTimeZone>
+
+// The Transaction signal hides the class inside FakeTransaction
+typedef PackageKit::Transaction PkTransaction;
+
+namespace {
+
+const QString TransactionInterface = QStringLiteral("org.freedesktop.PackageKit.Transaction");
+
+PkTransaction::Info updateInfo(uint index)
+{
+    static const PkTransaction::Info infos[] = {
+        PkTransaction::InfoNormal,
+        PkTransaction::InfoBugfix,
+        PkTransaction::InfoSecurity,
+        PkTransaction::InfoEnhancement,
+        PkTransaction::InfoImportant,
+        PkTransaction::InfoLow,
+    };
+    return infos[index % (sizeof(infos) / sizeof(infos[0]))];
+}
+
+QString timespec(uint index, int offset = 0)
+{
+    static const QDateTime base(QDate(2026, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    return base.addSecs(qint64(index) * 3600 + offset).toString(Qt::ISODate);
+}
+
+}
+
+QDBusArgument &operator<<(QDBusArgument &argument, const FakePackage &package)
+{
+    argument.beginStructure();
+    argument << package.info << package.packageId << package.summary;
+    argument.endStructure();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, FakePackage &package)
+{
+    argument.beginStructure();
+    argument >> package.info >> package.packageId >> package.summary;
+    argument.endStructure();
+    return argument;
+}
+
+QDBusArgument &operator<<(QDBusArgument &argument, const FakeUpdateDetail &detail)
+{
+    argument.beginStructure();
+    argument << detail.packageId
+             << detail.updates
+             << detail.obsoletes
+             << detail.vendorUrls
+             << detail.bugzillaUrls
+             << detail.cveUrls
+             << detail.restart
+             << detail.updateText
+             << detail.changelog
+             << detail.state
+             << detail.issued
+             << detail.updated;
+    argument.endStructure();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, FakeUpdateDetail &detail)
+{
+    argument.beginStructure();
+    argument >> detail.packageId
+             >> detail.updates
+             >> detail.obsoletes
+             >> detail.vendorUrls
+             >> detail.bugzillaUrls
+             >> detail.cveUrls
+             >> detail.restart
+             >> detail.updateText
+             >> detail.changelog
+             >> detail.state
+             >> detail.issued
+             >> detail.updated;
+    argument.endStructure();
+    return argument;
+}
+
+QDBusArgument &operator<<(QDBusArgument &argument, const FakeFiles &files)
+{
+    argument.beginStructure();
+    argument << files.packageId << files.files;
+    argument.endStructure();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, FakeFiles &files)
+{
+    argument.beginStructure();
+    argument >> files.packageId >> files.files;
+    argument.endStructure();
+    return argument;
+}
+
+FakeTransaction::FakeTransaction(FakeDaemon *daemon, const QString &path)
+    : QObject(daemon)
+    , m_daemon(daemon)
+    , m_path(path)
+    , m_config(daemon->config())
+{
+    m_step.setSingleShot(true);
+    connect(&m_step, &QTimer::timeout, this, &FakeTransaction::step);
+}
+
+QString FakeTransaction::path() const
+{
+    return m_path;
+}
+
+void FakeTransaction::SetHints(const QStringList &hints)
+{
+    m_hints = hints;
+}
+
+void FakeTransaction::Cancel()
+{
+    if (m_role == PkTransaction::RoleUnknown || m_finished) {
+        sendErrorReply(QStringLiteral("org.freedesktop.PackageKit.Transaction.NotRunning"),
+                       QStringLiteral("Nothing to cancel"));
+        return;
+    }
+
+    m_step.stop();
+    Q_EMIT ErrorCode(PkTransaction::ErrorTransactionCancelled, QStringLiteral("The transaction was cancelled"));
+    finish(PkTransaction::ExitCancelled);
+}
+
+void FakeTransaction::GetPackages(qulonglong filters)
+{
+    if (!begin(PkTransaction::RoleGetPackages)) {
+        return;
+    }
+
+    QList<int> indexes;
+    for (uint i = 0; i < m_config.packages; ++i) {
+        if (matches(i, filters)) {
+            indexes.append(int(i));
+        }
+    }
+
+    run(indexes.size(), [this, indexes] (int from, int to) {
+        QList<FakePackage> packages;
+        packages.reserve(to - from);
+        for (int i = from; i < to; ++i) {
+            const uint index = indexes[i];
+            packages.append({ FakeConfig::isInstalled(index) ? PkTransaction::InfoInstalled : PkTransaction::InfoAvailable,
+                              FakeConfig::packageId(index),
+                              FakeConfig::summary(index) });
+        }
+        sendPackages(packages);
+    });
+}
+
+void FakeTransaction::GetUpdates(qulonglong filters)
+{
+    Q_UNUSED(filters)
+    if (!begin(PkTransaction::RoleGetUpdates)) {
+        return;
+    }
+
+    run(int(qMin(m_config.updates, m_config.packages)), [this] (int from, int to) {
+        QList<FakePackage> packages;
+        packages.reserve(to - from);
+        for (int i = from; i < to; ++i) {
+            packages.append({ updateInfo(i), FakeConfig::updateId(i), FakeConfig::summary(i) });
+        }
+        sendPackages(packages);
+    });
+}
+
+void FakeTransaction::GetUpdateDetail(const QStringList &packageIds)
+{
+    if (!begin(PkTransaction::RoleGetUpdateDetail)) {
+        return;
+    }
+
+    const QList<int> indexes = validIndexes(packageIds);
+    run(indexes.size(), [this, indexes] (int from, int to) {
+        QList<FakeUpdateDetail> details;
+        details.reserve(to - from);
+        for (int i = from; i < to; ++i) {
+            const uint index = indexes[i];
+            details.append({ FakeConfig::updateId(index),
+                             { FakeConfig::packageId(index) },
+                             {},
+                             { QString(QLatin1String("https://example.com/advisories/FAKE-") + QString::number(index)) },
+                             { QString(QLatin1String("https://example.com/bugs/") + QString::number(index)) },
+                             {},
+                             PkTransaction::RestartNone,
+                             QLatin1String("Update text of fake package ") + QString::number(index),
+                             QLatin1String("* Fixes for fake package ") + QString::number(index),
+                             PkTransaction::UpdateStateStable,
+                             timespec(index),
+                             timespec(index, 60) });
+        }
+
+        if (usePluralSignals()) {
+            Q_EMIT UpdateDetails(details);
+            return;
+        }
+        for (const FakeUpdateDetail &detail : std::as_const(details)) {
+            Q_EMIT UpdateDetail(detail.packageId,
+                                detail.updates,
+                                detail.obsoletes,
+                                detail.vendorUrls,
+                                detail.bugzillaUrls,
+                                detail.cveUrls,
+                                detail.restart,
+                                detail.updateText,
+                                detail.changelog,
+                                detail.state,
+                                detail.issued,
+                                detail.updated);
+        }
+    });
+}
+
+void FakeTransaction::Resolve(qulonglong filters, const QStringList &packages)
+{
+    if (!begin(PkTransaction::RoleResolve)) {
+        return;
+    }
+
+    QList<int> indexes;
+    for (const QString &name : packages) {
+        const int index = FakeConfig::indexOfName(name);
+        if (index >= 0 && uint(index) < m_config.packages && matches(index, filters)) {
+            indexes.append(index);
+        }
+    }
+
+    run(indexes.size(), [this, indexes] (int from, int to) {
+        QList<FakePackage> packages;
+        for (int i = from; i < to; ++i) {
+            const uint index = indexes[i];
+            packages.append({ FakeConfig::isInstalled(index) ? PkTransaction::InfoInstalled : PkTransaction::InfoAvailable,
+                              FakeConfig::packageId(index),
+                              FakeConfig::summary(index) });
+        }
+        sendPackages(packages);
+    });
+}
+
+void FakeTransaction::SearchNames(qulonglong filters, const QStringList &values)
+{
+    if (!begin(PkTransaction::RoleSearchName)) {
+        return;
+    }
+
+    QList<int> indexes;
+    for (uint i = 0; i < m_config.packages; ++i) {
+        if (!matches(i, filters)) {
+            continue;
+        }
+        const QString name = FakeConfig::packageName(i);
+        for (const QString &value : values) {
+            if (name.contains(value)) {
+                indexes.append(int(i));
+                break;
+            }
+        }
+    }
+
+    run(indexes.size(), [this, indexes] (int from, int to) {
+        QList<FakePackage> packages;
+        for (int i = from; i < to; ++i) {
+            const uint index = indexes[i];
+            packages.append({ FakeConfig::isInstalled(index) ? PkTransaction::InfoInstalled : PkTransaction::InfoAvailable,
+                              FakeConfig::packageId(index),
+                              FakeConfig::summary(index) });
+        }
+        sendPackages(packages);
+    });
+}
+
+void FakeTransaction::GetDetails(const QStringList &packageIds)
+{
+    if (!begin(PkTransaction::RoleGetDetails)) {
+        return;
+    }
+
+    const QList<int> indexes = validIndexes(packageIds);
+    run(indexes.size(), [this, indexes] (int from, int to) {
+        for (int i = from; i < to; ++i) {
+            const uint index = indexes[i];
+            Q_EMIT Details({
+                { QStringLiteral("package-id"), FakeConfig::packageId(index) },
+                { QStringLiteral("summary"), FakeConfig::summary(index) },
+                { QStringLiteral("description"), QString(QLatin1String("Description of fake package ") + QString::number(index)) },
+                { QStringLiteral("url"), QString(QLatin1String("https://example.com/") + FakeConfig::packageName(index)) },
+                { QStringLiteral("license"), QStringLiteral("LGPL-2.0-or-later") },
+                { QStringLiteral("group"), uint(PkTransaction::GroupSystem) },
+                { QStringLiteral("size"), qulonglong(index + 1) * 1024 },
+            });
+        }
+    });
+}
+
+void FakeTransaction::GetFiles(const QStringList &packageIds)
+{
+    if (!begin(PkTransaction::RoleGetFiles)) {
+        return;
+    }
+
+    const QList<int> indexes = validIndexes(packageIds);
+    run(indexes.size(), [this, indexes] (int from, int to) {
+        QList<FakeFiles> lists;
+        lists.reserve(to - from);
+        for (int i = from; i < to; ++i) {
+            const uint index = indexes[i];
+            QStringList files;
+            files.reserve(m_config.filesPerPackage);
+            for (uint file = 0; file < m_config.filesPerPackage; ++file) {
+                files.append(FakeConfig::fileName(index, file));
+            }
+            lists.append({ FakeConfig::packageId(index), files });
+        }
+
+        if (usePluralSignals()) {
+            Q_EMIT FileLists(lists);
+            return;
+        }
+        for (const FakeFiles &files : std::as_const(lists)) {
+            Q_EMIT Files(files.packageId, files.files);
+        }
+    });
+}
+
+void FakeTransaction::GetOldTransactions(uint number)
+{
+    if (!begin(PkTransaction::RoleGetOldTransactions)) {
+        return;
+    }
+
+    const int count = int(number == 0 ? m_config.oldTransactions : qMin(number, m_config.oldTransactions));
+    run(count, [this] (int from, int to) {
+        // Newest first, like PackageKit
+        for (int i = from; i < to; ++i) {
+            const uint index = m_config.oldTransactions - 1 - i;
+            Q_EMIT Transaction(QDBusObjectPath(FakeConfig::oldTransactionTid(index)),
+                               timespec(index),
+                               index % 5 != 0,
+                               index % 2 ? PkTransaction::RoleUpdatePackages : PkTransaction::RoleInstallPackages,
+                               1000 + index,
+                               QLatin1String("installing\t") + FakeConfig::updateId(index),
+                               1000,
+                               QStringLiteral("fakepackagekit-client"));
+        }
+    });
+}
+
+bool FakeTransaction::begin(PackageKit::Transaction::Role role)
+{
+    if (m_role != PkTransaction::RoleUnknown) {
+        sendErrorReply(QStringLiteral("org.freedesktop.PackageKit.Transaction.RoleUnknown"),
+                       QStringLiteral("The transaction is already running"));
+        return false;
+    }
+
+    m_role = role;
+    m_status = PkTransaction::StatusSetup;
+    m_elapsed.start();
+    changed({
+        { QStringLiteral("Role"), m_role },
+        { QStringLiteral("Status"), m_status },
+    });
+    return true;
+}
+
+void FakeTransaction::run(int count, const Emitter &emitter)
+{
+    m_count = count;
+    m_emitter = emitter;
+
+    // Only start once the method call got its reply
+    m_step.start(0);
+}
+
+void FakeTransaction::step()
+{
+    if (m_status != PkTransaction::StatusRunning) {
+        m_status = PkTransaction::StatusRunning;
+        changed({ { QStringLiteral("Status"), m_status } });
+    }
+
+    if (m_progressStep < m_config.progressUpdates) {
+        ++m_progressStep;
+        m_percentage = m_progressStep * 100 / (m_config.progressUpdates + 1);
+        changed({
+            { QStringLiteral("Percentage"), m_percentage },
+            { QStringLiteral("ElapsedTime"), elapsedTime() },
+        });
+
+        const uint interval = m_config.progressRate ? 1000 / m_config.progressRate : 0;
+        m_step.start(int(interval));
+        return;
+    }
+
+    if (m_config.failingRole != 0 && m_config.failingRole == uint(m_role)) {
+        Q_EMIT ErrorCode(PkTransaction::ErrorInternalError, QStringLiteral("Failing as configured"));
+        finish(PkTransaction::ExitFailed);
+        return;
+    }
+
+    const int chunk = m_config.chunkSize ? int(m_config.chunkSize) : m_count;
+    const int to = qMin(m_count, m_next + chunk);
+    if (to > m_next) {
+        m_emitter(m_next, to);
+        m_next = to;
+    }
+
+    if (m_next < m_count) {
+        m_step.start(0);
+    } else {
+        finish(PkTransaction::ExitSuccess);
+    }
+}
+
+void FakeTransaction::finish(PackageKit::Transaction::Exit exit)
+{
+    m_finished = true;
+    m_emitter = nullptr;
+    m_percentage = 100;
+    m_status = PkTransaction::StatusFinished;
+    changed({
+        { QStringLiteral("Percentage"), m_percentage },
+        { QStringLiteral("Status"), m_status },
+    });
+
+    Q_EMIT Finished(exit, elapsedTime());
+
+    QTimer::singleShot(0, this, [this] {
+        Q_EMIT Destroy();
+        m_daemon->removeTransaction(this);
+    });
+}
+
+void FakeTransaction::sendPackages(const QList<FakePackage> &packages)
+{
+    if (packages.isEmpty()) {
+        return;
+    }
+    m_lastPackage = packages.constLast().packageId;
+
+    if (usePluralSignals()) {
+        Q_EMIT Packages(packages);
+        return;
+    }
+    for (const FakePackage &package : packages) {
+        Q_EMIT Package(package.info, package.packageId, package.summary);
+    }
+}
+
+bool FakeTransaction::usePluralSignals() const
+{
+    return m_config.pluralSignals && m_hints.contains(QLatin1String("supports-plural-signals=true"));
+}
+
+void FakeTransaction::changed(const QVariantMap &properties)
+{
+    FakeDaemon::sendPropertiesChanged(m_daemon->connection(), m_path, TransactionInterface, properties);
+}
+
+bool FakeTransaction::matches(uint index, qulonglong filters)
+{
+    if ((filters & PkTransaction::FilterInstalled) && !FakeConfig::isInstalled(index)) {
+        return false;
+    }
+    if ((filters & PkTransaction::FilterNotInstalled) && FakeConfig::isInstalled(index)) {
+        return false;
+    }
+    return true;
+}
+
+QList<int> FakeTransaction::validIndexes(const QStringList &packageIds) const
+{
+    QList<int> indexes;
+    indexes.reserve(packageIds.size());
+    for (const QString &packageId : packageIds) {
+        const int index = FakeConfig::indexOfPackageId(packageId);
+        if (index >= 0 && uint(index) < m_config.packages) {
+            indexes.append(index);
+        }
+    }
+    return indexes;
+}
+
+#include "moc_faketransaction.cpp"
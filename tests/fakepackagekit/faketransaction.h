@@ -0,0 +1,194 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef FAKE_TRANSACTION_H
+#define FAKE_TRANSACTION_H
+
+#include <QDBusArgument>
+#include <QDBusConnection>
+#include <QDBusContext>
+#include <QDBusObjectPath>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+
+#include <functional>
+
+#include <transaction.h>
+
+#include "fakeconfig.h"
+
+struct FakePackage {
+    uint info;
+    QString packageId;
+    QString summary;
+};
+
+struct FakeUpdateDetail {
+    QString packageId;
+    QStringList updates;
+    QStringList obsoletes;
+    QStringList vendorUrls;
+    QStringList bugzillaUrls;
+    QStringList cveUrls;
+    uint restart;
+    QString updateText;
+    QString changelog;
+    uint state;
+    QString issued;
+    QString updated;
+};
+
+struct FakeFiles {
+    QString packageId;
+    QStringList files;
+};
+
+Q_DECLARE_METATYPE(FakePackage)
+Q_DECLARE_METATYPE(FakeUpdateDetail)
+Q_DECLARE_METATYPE(FakeFiles)
+
+QDBusArgument &operator<<(QDBusArgument &argument, const FakePackage &package);
+const QDBusArgument &operator>>(const QDBusArgument &argument, FakePackage &package);
+QDBusArgument &operator<<(QDBusArgument &argument, const FakeUpdateDetail &detail);
+const QDBusArgument &operator>>(const QDBusArgument &argument, FakeUpdateDetail &detail);
+QDBusArgument &operator<<(QDBusArgument &argument, const FakeFiles &files);
+const QDBusArgument &operator>>(const QDBusArgument &argument, FakeFiles &files);
+
+class FakeDaemon;
+
+/**
+ * A transaction object of the fake daemon
+ *
+ * Each query role computes its results from the FakeConfig the
+ * transaction was created with, then sends them from the main loop:
+ * first the configured number of progress updates, then the results
+ * in chunks, then Finished and Destroy.
+ */
+class FakeTransaction : public QObject, protected QDBusContext
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.freedesktop.PackageKit.Transaction")
+    Q_PROPERTY(uint Role READ role)
+    Q_PROPERTY(uint Status READ status)
+    Q_PROPERTY(QString LastPackage READ lastPackage)
+    Q_PROPERTY(uint Uid READ uid)
+    Q_PROPERTY(uint Percentage READ percentage)
+    Q_PROPERTY(bool AllowCancel READ allowCancel)
+    Q_PROPERTY(bool CallerActive READ callerActive)
+    Q_PROPERTY(uint ElapsedTime READ elapsedTime)
+    Q_PROPERTY(uint RemainingTime READ remainingTime)
+    Q_PROPERTY(uint Speed READ speed)
+    Q_PROPERTY(qulonglong DownloadSizeRemaining READ downloadSizeRemaining)
+    Q_PROPERTY(qulonglong TransactionFlags READ transactionFlags)
+public:
+    FakeTransaction(FakeDaemon *daemon, const QString &path);
+
+    QString path() const;
+
+    uint role() const { return m_role; }
+    uint status() const { return m_status; }
+    QString lastPackage() const { return m_lastPackage; }
+    uint uid() const { return 1000; }
+    uint percentage() const { return m_percentage; }
+    bool allowCancel() const { return true; }
+    bool callerActive() const { return true; }
+    uint elapsedTime() const { return m_elapsed.isValid() ? uint(m_elapsed.elapsed()) : 0; }
+    uint remainingTime() const { return 0; }
+    uint speed() const { return 0; }
+    qulonglong downloadSizeRemaining() const { return 0; }
+    qulonglong transactionFlags() const { return 0; }
+
+public Q_SLOTS:
+    void SetHints(const QStringList &hints);
+    void Cancel();
+
+    void GetPackages(qulonglong filters);
+    void GetUpdates(qulonglong filters);
+    void GetUpdateDetail(const QStringList &packageIds);
+    void Resolve(qulonglong filters, const QStringList &packages);
+    void SearchNames(qulonglong filters, const QStringList &values);
+    void GetDetails(const QStringList &packageIds);
+    void GetFiles(const QStringList &packageIds);
+    void GetOldTransactions(uint number);
+
+Q_SIGNALS:
+    void Package(uint info, const QString &packageId, const QString &summary);
+    void Packages(const QList<FakePackage> &packages);
+    void Details(const QVariantMap &data);
+    void Files(const QString &packageId, const QStringList &fileList);
+    void FileLists(const QList<FakeFiles> &files);
+    void UpdateDetail(const QString &packageId,
+                      const QStringList &updates,
+                      const QStringList &obsoletes,
+                      const QStringList &vendorUrls,
+                      const QStringList &bugzillaUrls,
+                      const QStringList &cveUrls,
+                      uint restart,
+                      const QString &updateText,
+                      const QString &changelog,
+                      uint state,
+                      const QString &issued,
+                      const QString &updated);
+    void UpdateDetails(const QList<FakeUpdateDetail> &details);
+    void Transaction(const QDBusObjectPath &tid,
+                     const QString &timespec,
+                     bool succeeded,
+                     uint role,
+                     uint duration,
+                     const QString &data,
+                     uint uid,
+                     const QString &cmdline);
+    void ErrorCode(uint code, const QString &details);
+    void Finished(uint exit, uint runtime);
+    void Destroy();
+
+private:
+    typedef std::function<void(int from, int to)> Emitter;
+
+    bool begin(PackageKit::Transaction::Role role);
+    void run(int count, const Emitter &emitter);
+    void step();
+    void finish(PackageKit::Transaction::Exit exit);
+    void sendPackages(const QList<FakePackage> &packages);
+    bool usePluralSignals() const;
+    void changed(const QVariantMap &properties);
+
+    static bool matches(uint index, qulonglong filters);
+    QList<int> validIndexes(const QStringList &packageIds) const;
+
+    FakeDaemon *m_daemon;
+    QString m_path;
+    FakeConfig m_config;
+    QStringList m_hints;
+    QTimer m_step;
+    QElapsedTimer m_elapsed;
+    Emitter m_emitter;
+    int m_count = 0;
+    int m_next = 0;
+    uint m_progressStep = 0;
+    uint m_role = PackageKit::Transaction::RoleUnknown;
+    uint m_status = PackageKit::Transaction::StatusWait;
+    uint m_percentage = 0;
+    QString m_lastPackage;
+    bool m_finished = false;
+};
+
+#endif
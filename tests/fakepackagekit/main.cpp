@@ -0,0 +1,73 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+
+#include "fakedaemon.h"
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("fakepackagekitd"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("A fake PackageKit daemon for tests and benchmarks"));
+    parser.addHelpOption();
+
+    QCommandLineOption addressOption(QStringLiteral("address"),
+                                     QStringLiteral("Connect to the bus at <address> instead of the system bus."),
+                                     QStringLiteral("address"));
+    parser.addOption(addressOption);
+
+    // Every setting of FakeConfig can be given on the command line too
+    const QVariantMap defaults = FakeConfig().toVariantMap();
+    for (auto it = defaults.constBegin(); it != defaults.constEnd(); ++it) {
+        parser.addOption(QCommandLineOption(it.key(),
+                                            QLatin1String("Defaults to ") + it.value().toString() + QLatin1Char('.'),
+                                            QStringLiteral("value")));
+    }
+    parser.process(app);
+
+    QVariantMap values;
+    for (auto it = defaults.constBegin(); it != defaults.constEnd(); ++it) {
+        if (parser.isSet(it.key())) {
+            values.insert(it.key(), parser.value(it.key()));
+        }
+    }
+    FakeConfig config;
+    config.update(values);
+
+    QDBusConnection connection = parser.isSet(addressOption)
+            ? QDBusConnection::connectToBus(parser.value(addressOption), QStringLiteral("fakepackagekitd"))
+            : QDBusConnection::systemBus();
+    if (!connection.isConnected()) {
+        qCritical() << "Failed to connect to the bus:" << connection.lastError().message();
+        return 1;
+    }
+
+    FakeDaemon daemon(connection, config);
+    if (!daemon.registerOnBus()) {
+        return 1;
+    }
+
+    return app.exec();
+}
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <QTest>
+
+#include <packagesnapshot.h>
+
+using namespace PackageKit;
+
+// Pure logic, runs without the fake daemon
+class PackageSnapshotTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void packageSnapshotDiff_data();
+    void packageSnapshotDiff();
+};
+
+void PackageSnapshotTest::packageSnapshotDiff_data()
+{
+    QTest::addColumn<QStringList>("older");
+    QTest::addColumn<QStringList>("newer");
+    // "+new", "-old", "old>new" for upgrades and "old<new" for downgrades
+    QTest::addColumn<QStringList>("expected");
+
+    QTest::newRow("empty")
+        << QStringList()
+        << QStringList()
+        << QStringList();
+    QTest::newRow("empty-older")
+        << QStringList()
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora"), QStringLiteral("b;2.0;noarch;fedora") }
+        << QStringList{ QStringLiteral("+a;1.0;x86_64;fedora"), QStringLiteral("+b;2.0;noarch;fedora") };
+    QTest::newRow("empty-newer")
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora"), QStringLiteral("b;2.0;noarch;fedora") }
+        << QStringList()
+        << QStringList{ QStringLiteral("-a;1.0;x86_64;fedora"), QStringLiteral("-b;2.0;noarch;fedora") };
+    QTest::newRow("identical")
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora"), QStringLiteral("b;2.0;noarch;fedora") }
+        << QStringList{ QStringLiteral("b;2.0;noarch;fedora"), QStringLiteral("a;1.0;x86_64;fedora") }
+        << QStringList();
+    QTest::newRow("other-repo")
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora") }
+        << QStringList{ QStringLiteral("a;1.0;x86_64;updates") }
+        << QStringList();
+    QTest::newRow("upgraded")
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora"), QStringLiteral("b;1.0;x86_64;fedora") }
+        << QStringList{ QStringLiteral("a;1.1;x86_64;fedora"), QStringLiteral("b;1.0;x86_64;fedora") }
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora>a;1.1;x86_64;fedora") };
+    QTest::newRow("downgraded")
+        << QStringList{ QStringLiteral("a;1:1.0;x86_64;fedora") }
+        << QStringList{ QStringLiteral("a;2.0;x86_64;fedora") }
+        << QStringList{ QStringLiteral("a;1:1.0;x86_64;fedora<a;2.0;x86_64;fedora") };
+    QTest::newRow("two-old-one-kept")
+        << QStringList{ QStringLiteral("kernel;6.1;x86_64;fedora"), QStringLiteral("kernel;6.2;x86_64;fedora") }
+        << QStringList{ QStringLiteral("kernel;6.2;x86_64;fedora") }
+        << QStringList{ QStringLiteral("-kernel;6.1;x86_64;fedora") };
+    QTest::newRow("two-old-one-new")
+        << QStringList{ QStringLiteral("kernel;6.1;x86_64;fedora"), QStringLiteral("kernel;6.2;x86_64;fedora") }
+        << QStringList{ QStringLiteral("kernel;6.3;x86_64;fedora") }
+        << QStringList{ QStringLiteral("kernel;6.1;x86_64;fedora>kernel;6.3;x86_64;fedora"), QStringLiteral("-kernel;6.2;x86_64;fedora") };
+    QTest::newRow("one-old-three-kept")
+        << QStringList{ QStringLiteral("kernel;6.2;x86_64;fedora") }
+        << QStringList{ QStringLiteral("kernel;6.1;x86_64;fedora"), QStringLiteral("kernel;6.2;x86_64;fedora"), QStringLiteral("kernel;6.3;x86_64;fedora") }
+        << QStringList{ QStringLiteral("+kernel;6.1;x86_64;fedora"), QStringLiteral("+kernel;6.3;x86_64;fedora") };
+    QTest::newRow("one-old-three-new")
+        << QStringList{ QStringLiteral("kernel;6.1;x86_64;fedora") }
+        << QStringList{ QStringLiteral("kernel;6.4;x86_64;fedora"), QStringLiteral("kernel;6.2;x86_64;fedora"), QStringLiteral("kernel;6.3;x86_64;fedora") }
+        << QStringList{ QStringLiteral("kernel;6.1;x86_64;fedora>kernel;6.2;x86_64;fedora"), QStringLiteral("+kernel;6.3;x86_64;fedora"), QStringLiteral("+kernel;6.4;x86_64;fedora") };
+    QTest::newRow("arches")
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora"), QStringLiteral("a;1.0;i686;fedora") }
+        << QStringList{ QStringLiteral("a;2.0;x86_64;fedora"), QStringLiteral("a;1.0;i686;fedora") }
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora>a;2.0;x86_64;fedora") };
+    QTest::newRow("arch-changed")
+        << QStringList{ QStringLiteral("a;1.0;i686;fedora") }
+        << QStringList{ QStringLiteral("a;1.0;x86_64;fedora") }
+        << QStringList{ QStringLiteral("-a;1.0;i686;fedora"), QStringLiteral("+a;1.0;x86_64;fedora") };
+}
+
+void PackageSnapshotTest::packageSnapshotDiff()
+{
+    QFETCH(QStringList, older);
+    QFETCH(QStringList, newer);
+    QFETCH(QStringList, expected);
+
+    PackageSnapshot olderSnapshot;
+    for (const QString &packageId : std::as_const(older)) {
+        olderSnapshot.append(Transaction::InfoInstalled, packageId, QString());
+    }
+    PackageSnapshot newerSnapshot;
+    for (const QString &packageId : std::as_const(newer)) {
+        newerSnapshot.append(Transaction::InfoInstalled, packageId, QString());
+    }
+
+    QStringList changes;
+    const QList<PackageSnapshot::Change> diff = PackageSnapshot::diff(olderSnapshot, newerSnapshot);
+    for (const PackageSnapshot::Change &change : diff) {
+        switch (change.kind) {
+        case PackageSnapshot::Added:
+            QVERIFY(change.oldPackageId.isEmpty());
+            changes.append(QLatin1Char('+') + change.newPackageId);
+            break;
+        case PackageSnapshot::Removed:
+            QVERIFY(change.newPackageId.isEmpty());
+            changes.append(QLatin1Char('-') + change.oldPackageId);
+            break;
+        case PackageSnapshot::Upgraded:
+            changes.append(change.oldPackageId + QLatin1Char('>') + change.newPackageId);
+            break;
+        case PackageSnapshot::Downgraded:
+            changes.append(change.oldPackageId + QLatin1Char('<') + change.newPackageId);
+            break;
+        }
+    }
+
+    // Changes come in hash order
+    changes.sort();
+    expected.sort();
+    QCOMPARE(changes, expected);
+}
+
+QTEST_GUILESS_MAIN(PackageSnapshotTest)
+
+#include "packagesnapshottest.moc"
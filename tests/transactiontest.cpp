@@ -0,0 +1,1110 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <QDeadlineTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPointer>
+#include <QScopeGuard>
+#include <QSet>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QThread>
+
+#include <daemon.h>
+#include <details.h>
+#include <detailsprefetcher.h>
+#include <filelist.h>
+#include <fileownerindex.h>
+#include <packagedetails.h>
+#include <metrics.h>
+#include <packagemodel.h>
+#include <packageproxymodel.h>
+#include <transactionhistory.h>
+#include <transactionprogress.h>
+#include <transactionrecorder.h>
+#include <transactionreplayer.h>
+#include <transactiontimings.h>
+#include <updatedetail.h>
+#include <tracing.h>
+#include <updatetracker.h>
+
+#include "fakepackagekit.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace PackageKit;
+
+class TransactionTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    void daemonProperties();
+    void getPackages_data();
+    void getPackages();
+    void packageModel();
+    void getUpdatesDetails_data();
+    void getUpdatesDetails();
+    void threadedDecoding();
+    void concurrentThreads_data();
+    void concurrentThreads();
+    void setConnectionFromThread();
+    void resolve();
+    void getDetails();
+    void detailsPrefetcher();
+    void detailsPrefetcherCancel();
+    void getFiles_data();
+    void getFiles();
+    void transactionRecords();
+    void progress();
+    void progressSnapshot();
+    void cancel();
+    void timings();
+    void metrics();
+    void tracing();
+    void recordReplay();
+    void updateTracker();
+    void transactionHistory();
+    void transactionHistoryReset_data();
+    void transactionHistoryReset();
+    void fileOwnerIndex();
+    void daemonRestart();
+
+private:
+    static Transaction::Exit waitFinished(Transaction *transaction);
+
+    FakePackageKit m_fake;
+};
+
+Transaction::Exit TransactionTest::waitFinished(Transaction *transaction)
+{
+    QSignalSpy finished(transaction, &Transaction::finished);
+    if (!finished.wait(10000)) {
+        return Transaction::ExitUnknown;
+    }
+    return finished.constFirst().constFirst().value<Transaction::Exit>();
+}
+
+void TransactionTest::initTestCase()
+{
+    QVERIFY2(m_fake.start(), qPrintable(m_fake.errorString()));
+}
+
+void TransactionTest::init()
+{
+    QVERIFY(m_fake.configure(FakeConfig().toVariantMap()));
+}
+
+void TransactionTest::cleanup()
+{
+    // Every transaction must be gone once its client saw it finish
+    QTRY_COMPARE(m_fake.transactionCount(), 0u);
+}
+
+void TransactionTest::daemonProperties()
+{
+    QTRY_VERIFY(Daemon::isRunning());
+    QTRY_COMPARE(Daemon::backendName(), QStringLiteral("fake"));
+    QCOMPARE(Daemon::networkState(), Daemon::NetworkOnline);
+
+    QSignalSpy networkStateChanged(Daemon::global(), &Daemon::networkStateChanged);
+    QVERIFY(m_fake.setDaemonProperty(QStringLiteral("NetworkState"), uint(Daemon::NetworkWifi)));
+    QVERIFY(networkStateChanged.wait());
+    QCOMPARE(Daemon::networkState(), Daemon::NetworkWifi);
+}
+
+void TransactionTest::getPackages_data()
+{
+    QTest::addColumn<uint>("packages");
+    QTest::addColumn<Transaction::Filters>("filters");
+    QTest::addColumn<bool>("pluralSignals");
+    QTest::addColumn<uint>("chunkSize");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("all") << 100u << Transaction::Filters(Transaction::FilterNone) << true << 0u << 100;
+    QTest::newRow("installed") << 101u << Transaction::Filters(Transaction::FilterInstalled) << true << 0u << 51;
+    QTest::newRow("not-installed") << 101u << Transaction::Filters(Transaction::FilterNotInstalled) << true << 0u << 50;
+    QTest::newRow("single-signals") << 100u << Transaction::Filters(Transaction::FilterNone) << false << 0u << 100;
+    QTest::newRow("chunked") << 1000u << Transaction::Filters(Transaction::FilterNone) << true << 64u << 1000;
+    QTest::newRow("empty") << 0u << Transaction::Filters(Transaction::FilterNone) << true << 0u << 0;
+}
+
+void TransactionTest::getPackages()
+{
+    QFETCH(uint, packages);
+    QFETCH(Transaction::Filters, filters);
+    QFETCH(bool, pluralSignals);
+    QFETCH(uint, chunkSize);
+    QFETCH(int, expected);
+
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), packages },
+        { QStringLiteral("pluralSignals"), pluralSignals },
+        { QStringLiteral("chunkSize"), chunkSize },
+    }));
+
+    QStringList packageIds;
+    Transaction *transaction = Daemon::getPackages(filters);
+    connect(transaction, &Transaction::package,
+            this, [&packageIds] (Transaction::Info info, const QString &packageID) {
+        QCOMPARE(info == Transaction::InfoInstalled,
+                 FakeConfig::isInstalled(FakeConfig::indexOfPackageId(packageID)));
+        packageIds.append(packageID);
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+
+    QCOMPARE(packageIds.size(), expected);
+    QCOMPARE(QSet<QString>(packageIds.cbegin(), packageIds.cend()).size(), expected);
+}
+
+void TransactionTest::packageModel()
+{
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 1000u },
+        { QStringLiteral("chunkSize"), 100u },
+    }));
+
+    PackageModel model;
+    PackageProxyModel proxy;
+    proxy.setSourceModel(&model);
+    QSignalSpy inserted(&model, &QAbstractItemModel::rowsInserted);
+
+    Transaction *transaction = Daemon::getPackages();
+    model.addTransaction(transaction);
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+
+    // At most one chunk per plural signal
+    QCOMPARE(model.count(), 1000);
+    QVERIFY(inserted.size() >= 1 && inserted.size() <= 10);
+
+    const int row = FakeConfig::indexOfPackageId(model.packageId(42));
+    QVERIFY(row >= 0);
+    const QModelIndex index = model.index(42);
+    QCOMPARE(index.data().toString(), FakeConfig::packageName(row));
+    QCOMPARE(index.data(PackageModel::NameRole).toString(), FakeConfig::packageName(row));
+    QCOMPARE(index.data(PackageModel::VersionRole).toString(), QStringLiteral("1.0-1"));
+    QCOMPARE(index.data(PackageModel::ArchRole).toString(), QStringLiteral("x86_64"));
+    QCOMPARE(index.data(PackageModel::RepoRole).toString(),
+             FakeConfig::isInstalled(row) ? QStringLiteral("installed") : QStringLiteral("fake-repo"));
+    QCOMPARE(index.data(PackageModel::SummaryRole).toString(), FakeConfig::summary(row));
+    QCOMPARE(index.data(PackageModel::InfoRole).value<Transaction::Info>(),
+             FakeConfig::isInstalled(row) ? Transaction::InfoInstalled : Transaction::InfoAvailable);
+
+    // Sorted by name, the names end with the zero padded index
+    QCOMPARE(proxy.rowCount(), 1000);
+    QCOMPARE(proxy.index(0, 0).data().toString(), FakeConfig::packageName(0));
+    QCOMPARE(proxy.index(999, 0).data().toString(), FakeConfig::packageName(999));
+    proxy.sort(0, Qt::DescendingOrder);
+    QCOMPARE(proxy.index(0, 0).data().toString(), FakeConfig::packageName(999));
+
+    proxy.setFilterInfo(Transaction::InfoInstalled);
+    QCOMPARE(proxy.rowCount(), 500);
+    proxy.setFilterText(QStringLiteral("00012"));
+    QCOMPARE(proxy.rowCount(), 6);
+    proxy.setFilterInfo(Transaction::InfoUnknown);
+    QCOMPARE(proxy.rowCount(), 11);
+
+    // New chunks are merged into the sorted and filtered rows
+    model.addPackage(Transaction::InfoAvailable, FakeConfig::packageId(100012), FakeConfig::summary(100012));
+    QCOMPARE(model.count(), 1000);
+    QTRY_COMPARE(model.count(), 1001);
+    QCOMPARE(proxy.rowCount(), 12);
+    QCOMPARE(proxy.index(0, 0).data().toString(), FakeConfig::packageName(100012));
+
+    model.clear();
+    QCOMPARE(proxy.rowCount(), 0);
+
+    // Versions sort the way the package manager orders them
+    proxy.setFilterText(QString());
+    proxy.setSortRole(PackageModel::VersionRole);
+    proxy.sort(0, Qt::AscendingOrder);
+    for (const char *version : { "1.10", "1.0^1", "1.9", "1.0.1" }) {
+        model.addPackage(Transaction::InfoAvailable,
+                         QStringLiteral("foo;") + QLatin1String(version) + QLatin1String(";x86_64;fedora"),
+                         QString());
+    }
+    model.flush();
+    auto versions = [&proxy] {
+        QStringList ret;
+        for (int row = 0; row < proxy.rowCount(); ++row) {
+            ret.append(proxy.index(row, 0).data(PackageModel::VersionRole).toString());
+        }
+        return ret;
+    };
+    QCOMPARE(versions(), QStringList({ QStringLiteral("1.0^1"), QStringLiteral("1.0.1"), QStringLiteral("1.9"), QStringLiteral("1.10") }));
+
+    // A caret is an ordinary symbol for dpkg, sorting after a dot
+    model.setVersionScheme(VersionCompare::SchemeDpkg);
+    QCOMPARE(versions(), QStringList({ QStringLiteral("1.0.1"), QStringLiteral("1.0^1"), QStringLiteral("1.9"), QStringLiteral("1.10") }));
+}
+
+void TransactionTest::getUpdatesDetails_data()
+{
+    QTest::addColumn<bool>("pluralSignals");
+
+    QTest::newRow("plural") << true;
+    QTest::newRow("single") << false;
+}
+
+void TransactionTest::getUpdatesDetails()
+{
+    QFETCH(bool, pluralSignals);
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("updates"), 20u },
+        { QStringLiteral("pluralSignals"), pluralSignals },
+    }));
+
+    QStringList updates;
+    Transaction *transaction = Daemon::getUpdates();
+    connect(transaction, &Transaction::package,
+            this, [&updates] (Transaction::Info info, const QString &packageID) {
+        QVERIFY(info != Transaction::InfoInstalled && info != Transaction::InfoAvailable);
+        updates.append(packageID);
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QCOMPARE(updates.size(), 20);
+    QCOMPARE(updates.constFirst(), FakeConfig::updateId(0));
+
+    transaction = Daemon::getUpdatesDetails(updates);
+    QSignalSpy details(transaction, &Transaction::updateDetail);
+    QList<UpdateDetail> batched;
+    connect(transaction, &Transaction::updateDetails, this, [&batched] (const QList<UpdateDetail> &batch) {
+        batched += batch;
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QCOMPARE(details.size(), 20);
+    QCOMPARE(batched.size(), 20);
+    for (int i = 0; i < details.size(); ++i) {
+        const QList<QVariant> &detail = details.at(i);
+        QCOMPARE(detail.at(0).toString(), updates.at(i));
+        QCOMPARE(detail.at(1).toStringList(), QStringList{ FakeConfig::packageId(i) });
+        QVERIFY(detail.at(10).toDateTime().isValid());
+        QVERIFY(detail.at(10).toDateTime() < detail.at(11).toDateTime());
+
+        const UpdateDetail &entry = batched.at(i);
+        QCOMPARE(entry.packageId(), updates.at(i));
+        QCOMPARE(entry.updates(), QStringList{ FakeConfig::packageId(i) });
+        QCOMPARE(entry.changelog(), detail.at(8).toString());
+        QCOMPARE(entry.issued(), detail.at(10).toDateTime());
+        QCOMPARE(entry.updated(), detail.at(11).toDateTime());
+    }
+}
+
+void TransactionTest::threadedDecoding()
+{
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 1000u },
+        { QStringLiteral("updates"), 20u },
+        { QStringLiteral("chunkSize"), 64u },
+    }));
+
+    Daemon::setThreadedDecoding(true);
+    auto guard = qScopeGuard([] { Daemon::setThreadedDecoding(false); });
+    QVERIFY(Daemon::threadedDecoding());
+
+    // Every batch has to arrive on this thread, and before finished()
+    QStringList packageIds;
+    bool sawFinished = false;
+    Transaction *transaction = Daemon::getPackages();
+    connect(transaction, &Transaction::package,
+            this, [&packageIds, &sawFinished] (Transaction::Info, const QString &packageID) {
+        QCOMPARE(QThread::currentThread(), qApp->thread());
+        QVERIFY(!sawFinished);
+        packageIds.append(packageID);
+    });
+    connect(transaction, &Transaction::finished, this, [&sawFinished] {
+        sawFinished = true;
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QCOMPARE(packageIds.size(), 1000);
+    QCOMPARE(packageIds.constLast(), FakeConfig::packageId(999));
+
+    QStringList updates;
+    for (uint i = 0; i < 20; ++i) {
+        updates.append(FakeConfig::updateId(i));
+    }
+    transaction = Daemon::getUpdatesDetails(updates);
+    QSignalSpy details(transaction, &Transaction::updateDetail);
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QCOMPARE(details.size(), 20);
+    QCOMPARE(details.constLast().at(0).toString(), updates.constLast());
+    QVERIFY(details.constLast().at(10).toDateTime().isValid());
+    QVERIFY(details.constLast().at(10).toDateTime() < details.constLast().at(11).toDateTime());
+}
+
+void TransactionTest::concurrentThreads_data()
+{
+    QTest::addColumn<bool>("setConnection");
+
+    QTest::newRow("plain") << false;
+    QTest::newRow("setConnection") << true;
+}
+
+void TransactionTest::concurrentThreads()
+{
+    QFETCH(bool, setConnection);
+    QVERIFY(m_fake.configure({ { QStringLiteral("packages"), 100u } }));
+
+    constexpr int Threads = 8;
+    constexpr int PerThread = 25;
+    std::atomic<int> succeeded = 0;
+    std::atomic<int> packages = 0;
+
+    QList<QThread *> threads;
+    for (int i = 0; i < Threads; ++i) {
+        threads.append(QThread::create([&succeeded, &packages, i] {
+            QEventLoop loop;
+            int running = 0;
+            for (int j = 0; j < PerThread; ++j) {
+                Transaction *transaction = Daemon::resolve(FakeConfig::packageName((i * PerThread + j) % 100));
+                if (transaction->thread() != QThread::currentThread()) {
+                    return;
+                }
+                ++running;
+                QObject::connect(transaction, &Transaction::package, [&packages] {
+                    ++packages;
+                });
+                QObject::connect(transaction, &Transaction::finished,
+                                 [&loop, &running, &succeeded] (Transaction::Exit status) {
+                    if (status == Transaction::ExitSuccess) {
+                        ++succeeded;
+                    }
+                    if (--running == 0) {
+                        loop.quit();
+                    }
+                });
+            }
+            loop.exec();
+        }));
+    }
+    for (QThread *thread : std::as_const(threads)) {
+        thread->start();
+    }
+    if (setConnection) {
+        // Set the same connection again and again while the workers create transactions
+        const QDBusConnection connection = Daemon::connection();
+        QDeadlineTimer deadline(30000);
+        auto running = [&threads] {
+            return std::any_of(threads.cbegin(), threads.cend(), [] (QThread *thread) {
+                return !thread->isFinished();
+            });
+        };
+        while (running() && !deadline.hasExpired()) {
+            Daemon::setConnection(connection);
+            QTest::qWait(1);
+        }
+    }
+    for (QThread *thread : std::as_const(threads)) {
+        QVERIFY(thread->wait(30000));
+        delete thread;
+    }
+
+    QCOMPARE(succeeded.load(), Threads * PerThread);
+    QCOMPARE(packages.load(), Threads * PerThread);
+}
+
+void TransactionTest::setConnectionFromThread()
+{
+    QTRY_VERIFY(Daemon::isRunning());
+
+    // Blocks the worker until the main thread switched over
+    const QDBusConnection connection = Daemon::connection();
+    QThread *thread = QThread::create([connection] {
+        Daemon::setConnection(connection);
+    });
+    thread->start();
+    QTRY_VERIFY_WITH_TIMEOUT(thread->isFinished(), 10000);
+    delete thread;
+
+    QCOMPARE(Daemon::connection().name(), connection.name());
+    QTRY_VERIFY(Daemon::isRunning());
+    Transaction *transaction = Daemon::getPackages();
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+}
+
+void TransactionTest::resolve()
+{
+    QVERIFY(m_fake.configure({ { QStringLiteral("packages"), 10u } }));
+
+    const QStringList names{
+        FakeConfig::packageName(1),
+        FakeConfig::packageName(4),
+        FakeConfig::packageName(10),
+        QStringLiteral("does-not-exist"),
+    };
+
+    QStringList packageIds;
+    Transaction *transaction = Daemon::resolve(names, Transaction::FilterInstalled);
+    connect(transaction, &Transaction::package,
+            this, [&packageIds] (Transaction::Info, const QString &packageID) {
+        packageIds.append(packageID);
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QCOMPARE(packageIds, QStringList{ FakeConfig::packageId(4) });
+}
+
+void TransactionTest::getDetails()
+{
+    QList<Details> details;
+    Transaction *transaction = Daemon::getDetails({ FakeConfig::packageId(3), FakeConfig::packageId(7) });
+    connect(transaction, &Transaction::details, this, [&details] (const Details &value) {
+        details.append(value);
+    });
+    QList<PackageDetails> batched;
+    connect(transaction, &Transaction::packageDetails, this, [&batched] (const QList<PackageDetails> &batch) {
+        batched.append(batch);
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+
+    QCOMPARE(details.size(), 2);
+    QCOMPARE(details.at(0).packageId(), FakeConfig::packageId(3));
+    QCOMPARE(details.at(0).summary(), FakeConfig::summary(3));
+    QCOMPARE(details.at(0).group(), Transaction::GroupSystem);
+    QCOMPARE(details.at(1).size(), qulonglong(8 * 1024));
+
+    // The typed details carry the same values
+    QCOMPARE(batched.size(), 2);
+    for (int i = 0; i < batched.size(); ++i) {
+        const PackageDetails &value = batched.at(i);
+        QCOMPARE(value.packageId(), details.at(i).packageId());
+        QCOMPARE(value.summary(), details.at(i).summary());
+        QCOMPARE(value.description(), details.at(i).description());
+        QCOMPARE(value.group(), details.at(i).group());
+        QCOMPARE(value.url(), details.at(i).url());
+        QCOMPARE(value.license(), details.at(i).license());
+        QCOMPARE(value.size(), details.at(i).size());
+        QVERIFY(value.contains(PackageDetails::FieldSize));
+        QVERIFY(!value.contains(PackageDetails::FieldDownloadSize));
+        QCOMPARE(value.toVariantMap(), QVariantMap(details.at(i)));
+    }
+}
+
+void TransactionTest::detailsPrefetcher()
+{
+    QStringList packageIds;
+    for (uint i = 0; i < 100; ++i) {
+        packageIds.append(FakeConfig::packageId(i));
+    }
+
+    DetailsPrefetcher prefetcher;
+    prefetcher.setPackageIds(packageIds);
+    prefetcher.setPrefetchCount(10);
+    QSignalSpy ready(&prefetcher, &DetailsPrefetcher::detailsReady);
+
+    // Row by row, like a view asking while it paints
+    for (int row = 0; row < 10; ++row) {
+        QVERIFY(!prefetcher.request(packageIds.at(row)));
+    }
+    prefetcher.setVisibleRange(0, 9);
+    QVERIFY(prefetcher.isBusy());
+    QTRY_VERIFY(!prefetcher.isBusy());
+
+    // A single transaction for the visible rows and the ones below
+    QCOMPARE(ready.size(), 1);
+    QCOMPARE(ready.constFirst().constFirst().value<QList<PackageDetails>>().size(), 20);
+    QVERIFY(prefetcher.contains(packageIds.at(19)));
+    QVERIFY(!prefetcher.contains(packageIds.at(20)));
+    QCOMPARE(prefetcher.details(packageIds.at(3)).summary(), FakeConfig::summary(3));
+    QVERIFY(prefetcher.request(packageIds.at(3)));
+
+    // Scrolling up fetches the rows above the view
+    prefetcher.setVisibleRange(60, 69);
+    QTRY_VERIFY(!prefetcher.isBusy());
+    prefetcher.setVisibleRange(50, 59);
+    QTRY_VERIFY(!prefetcher.isBusy());
+    QCOMPARE(ready.size(), 3);
+    QVERIFY(prefetcher.contains(packageIds.at(40)));
+    QVERIFY(!prefetcher.contains(packageIds.at(39)));
+    QVERIFY(prefetcher.contains(packageIds.at(79)));
+    QVERIFY(!prefetcher.contains(packageIds.at(80)));
+
+    // Only the most recently used ones are kept
+    QVERIFY(prefetcher.request(packageIds.at(0)));
+    prefetcher.setCacheSize(1);
+    QVERIFY(prefetcher.contains(packageIds.at(0)));
+    QVERIFY(!prefetcher.contains(packageIds.at(40)));
+}
+
+void TransactionTest::detailsPrefetcherCancel()
+{
+    // Long enough to scroll away in the middle of it
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("progressUpdates"), 500u },
+        { QStringLiteral("progressRate"), 100u },
+    }));
+
+    QStringList packageIds;
+    for (uint i = 0; i < 100; ++i) {
+        packageIds.append(FakeConfig::packageId(i));
+    }
+
+    DetailsPrefetcher prefetcher;
+    prefetcher.setPackageIds(packageIds);
+    prefetcher.setPrefetchCount(0);
+    QSignalSpy errors(&prefetcher, &DetailsPrefetcher::errorCode);
+
+    prefetcher.setVisibleRange(0, 9);
+    QTRY_COMPARE(m_fake.transactionCount(), 1u);
+    QTest::qWait(200);
+
+    QVERIFY(m_fake.configure(FakeConfig().toVariantMap()));
+    prefetcher.setVisibleRange(90, 99);
+    QTRY_VERIFY(!prefetcher.isBusy());
+
+    QVERIFY(!prefetcher.contains(packageIds.at(0)));
+    QVERIFY(prefetcher.contains(packageIds.at(90)));
+    QVERIFY(prefetcher.contains(packageIds.at(99)));
+    QVERIFY(errors.isEmpty());
+}
+
+void TransactionTest::getFiles_data()
+{
+    QTest::addColumn<bool>("pluralSignals");
+
+    QTest::newRow("plural") << true;
+    QTest::newRow("single") << false;
+}
+
+void TransactionTest::getFiles()
+{
+    QFETCH(bool, pluralSignals);
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 1200u },
+        { QStringLiteral("filesPerPackage"), 5u },
+        { QStringLiteral("pluralSignals"), pluralSignals },
+    }));
+
+    Transaction *transaction = Daemon::getFiles({ FakeConfig::packageId(0), FakeConfig::packageId(1) });
+    QSignalSpy files(transaction, &Transaction::files);
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+
+    QCOMPARE(files.size(), 2);
+    QCOMPARE(files.at(1).at(0).toString(), FakeConfig::packageId(1));
+    const QStringList fileList = files.at(1).at(1).toStringList();
+    QCOMPARE(fileList.size(), 5);
+    QCOMPARE(fileList.constLast(), FakeConfig::fileName(1, 4));
+
+    // The batches hold the files of every package, in order
+    QStringList packageIds;
+    for (uint i = 0; i < 1200; ++i) {
+        packageIds.append(FakeConfig::packageId(i));
+    }
+    QList<FileList> batches;
+    transaction = Daemon::getFiles(packageIds);
+    connect(transaction, &Transaction::fileList, this, [&batches] (const FileList &batch) {
+        batches.append(batch);
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+
+    if (!pluralSignals) {
+        // Singular signals are gathered in batches of 1000 packages
+        QCOMPARE(batches.size(), 2);
+    }
+    int packages = 0;
+    qsizetype utf16Size = 0;
+    for (const FileList &batch : std::as_const(batches)) {
+        for (int i = 0; i < batch.packageCount(); ++i, ++packages) {
+            QCOMPARE(batch.packageID(i), FakeConfig::packageId(packages));
+            QCOMPARE(batch.fileCount(i), 5);
+            const QStringList expected = { FakeConfig::fileName(packages, 0),
+                                           FakeConfig::fileName(packages, 1),
+                                           FakeConfig::fileName(packages, 2),
+                                           FakeConfig::fileName(packages, 3),
+                                           FakeConfig::fileName(packages, 4) };
+            QCOMPARE(batch.files(i), expected);
+            QCOMPARE(batch.file(batch.firstFile(i) + 3), expected.at(3));
+            QCOMPARE(batch.packageOf(batch.firstFile(i) + 4), i);
+            for (const QString &file : expected) {
+                utf16Size += file.size() * 2;
+            }
+        }
+    }
+    QCOMPARE(packages, 1200);
+
+    qsizetype encodedSize = 0;
+    for (const FileList &batch : std::as_const(batches)) {
+        encodedSize += batch.encodedSize();
+    }
+    QVERIFY2(encodedSize * 4 < utf16Size, qPrintable(QString::number(encodedSize)));
+
+    // Packages without files keep their place
+    FileList list;
+    list.addPackage(QStringLiteral("empty;1;x86_64;repo"));
+    list.append(QStringLiteral("full;1;x86_64;repo"), { QStringLiteral("/usr/bin/full"), QStringLiteral("/usr/bin/fully") });
+    QCOMPARE(list.packageCount(), 2);
+    QCOMPARE(list.fileCount(0), 0);
+    QCOMPARE(list.fileCount(), 2);
+    QCOMPARE(list.packageOf(0), 1);
+    QCOMPARE(list.file(1), QStringLiteral("/usr/bin/fully"));
+    QCOMPARE(list.file(2), QString());
+}
+
+void TransactionTest::transactionRecords()
+{
+    QVERIFY(m_fake.configure({ { QStringLiteral("oldTransactions"), 30u } }));
+
+    QList<TransactionRecord> records;
+    Transaction *transaction = Daemon::getOldTransactions(25);
+    connect(transaction, &Transaction::transactionRecords,
+            this, [&records] (const QList<TransactionRecord> &batch) {
+        records.append(batch);
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+
+    QCOMPARE(records.size(), 25);
+    QCOMPARE(records.constFirst().tid().path(), FakeConfig::oldTransactionTid(29));
+    QCOMPARE(records.constLast().tid().path(), FakeConfig::oldTransactionTid(5));
+    QVERIFY(records.constFirst().timespec() > records.constLast().timespec());
+    QCOMPARE(records.constFirst().dataLines().size(), 1);
+}
+
+void TransactionTest::progress()
+{
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 3u },
+        { QStringLiteral("progressUpdates"), 9u },
+    }));
+
+    QList<uint> percentages;
+    Transaction *transaction = Daemon::getPackages();
+    connect(transaction, &Transaction::percentageChanged, this, [&percentages, transaction] {
+        percentages.append(transaction->percentage());
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+
+    QVERIFY(percentages.size() >= 9);
+    QVERIFY(std::is_sorted(percentages.cbegin(), percentages.cend()));
+}
+
+void TransactionTest::progressSnapshot()
+{
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 3u },
+        { QStringLiteral("progressUpdates"), 50u },
+        { QStringLiteral("progressRate"), 500u },
+    }));
+
+    QVERIFY(!TransactionProgress().isValid());
+
+    Transaction *transaction = Daemon::getPackages();
+    const TransactionProgress progress = transaction->progress();
+    QVERIFY(progress.isValid());
+    QVERIFY(!progress.snapshot().finished);
+
+    // Sample from another thread while the transaction runs, like a render thread would
+    QList<uint> percentages;
+    QThread *reader = QThread::create([progress, &percentages] {
+        quint32 generation = 0;
+        for (;;) {
+            if (progress.generation() == generation) {
+                QThread::yieldCurrentThread();
+                continue;
+            }
+            generation = progress.generation();
+            const ProgressSnapshot snapshot = progress.snapshot();
+            if (snapshot.finished) {
+                break;
+            }
+            percentages.append(snapshot.percentage);
+        }
+    });
+    reader->start();
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QVERIFY(reader->wait(10000));
+    delete reader;
+
+    QVERIFY(!percentages.isEmpty());
+    QVERIFY(std::is_sorted(percentages.cbegin(), percentages.cend()));
+    QTRY_VERIFY(progress.snapshot().finished);
+}
+
+void TransactionTest::cancel()
+{
+    // Long enough to cancel in the middle of it
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("progressUpdates"), 500u },
+        { QStringLiteral("progressRate"), 100u },
+    }));
+
+    QPointer<Transaction> transaction = Daemon::getPackages();
+    QSignalSpy errors(transaction.data(), &Transaction::errorCode);
+    QTRY_COMPARE(transaction->status(), Transaction::StatusRunning);
+
+    transaction->cancel();
+    QCOMPARE(waitFinished(transaction), Transaction::ExitCancelled);
+    QCOMPARE(errors.size(), 1);
+    QCOMPARE(errors.constFirst().constFirst().value<Transaction::Error>(), Transaction::ErrorTransactionCancelled);
+}
+
+void TransactionTest::timings()
+{
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 10u },
+        { QStringLiteral("chunkSize"), 4u },
+    }));
+
+    QList<TransactionTimings> observed;
+    Transaction::setTimingsObserver([&observed] (const Transaction *, const TransactionTimings &timings) {
+        observed.append(timings);
+    });
+    const auto resetObserver = qScopeGuard([] {
+        Transaction::setTimingsObserver(Transaction::TimingsObserver());
+    });
+
+    QPointer<Transaction> transaction = Daemon::getPackages();
+    TransactionTimings timings;
+    connect(transaction, &Transaction::finished, this, [&timings, transaction] {
+        timings = transaction->timings();
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QTRY_VERIFY(!transaction);
+
+    // finished() is emitted right after the phase is recorded
+    for (int phase = TransactionTimings::PhaseConstructed; phase < TransactionTimings::PhaseDestroyed; ++phase) {
+        QVERIFY2(timings.hasPhase(TransactionTimings::Phase(phase)), QByteArray::number(phase));
+    }
+    QVERIFY(!timings.hasPhase(TransactionTimings::PhaseDestroyed));
+    QVERIFY(timings.elapsed(TransactionTimings::PhaseConstructed, TransactionTimings::PhaseCreated) >= 0);
+    QVERIFY(timings.elapsed(TransactionTimings::PhaseFirstPackage, TransactionTimings::PhaseLastPackage) >= 0);
+    QVERIFY(timings.elapsed(TransactionTimings::PhaseLastPackage, TransactionTimings::PhaseFinished) >= 0);
+
+    QCOMPARE(observed.size(), 1);
+    QVERIFY(observed.constFirst().elapsed(TransactionTimings::PhaseFinished, TransactionTimings::PhaseDestroyed) >= 0);
+}
+
+void TransactionTest::metrics()
+{
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 10u },
+        { QStringLiteral("chunkSize"), 4u },
+    }));
+
+    Metrics::setEnabled(true);
+    Metrics::reset();
+    const auto disable = qScopeGuard([] {
+        Metrics::setEnabled(false);
+    });
+
+    const quint64 live = Metrics::snapshot().liveTransactions;
+    QPointer<Transaction> transaction = Daemon::getPackages();
+    QSignalSpy packages(transaction.data(), &Transaction::package);
+    QCOMPARE(Metrics::snapshot().liveTransactions, live + 1);
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QTRY_VERIFY(!transaction);
+
+    const Metrics::Snapshot snapshot = Metrics::snapshot();
+    QCOMPARE(snapshot.packagesEmitted, quint64(10));
+    QCOMPARE(snapshot.liveTransactions, live);
+    QVERIFY(snapshot.peakTransactions >= live + 1);
+    // CreateTransaction, GetAll, SetHints and GetPackages
+    QCOMPARE(snapshot.methodCalls, quint64(4));
+    // Three Packages, Finished and Destroy at least
+    QVERIFY(snapshot.signalsReceived >= 5);
+    QVERIFY(snapshot.bytesDecoded > quint64(10 * FakeConfig::packageId(0).size()));
+    QVERIFY(snapshot.queuedPropertyNotifications > 0);
+
+    const QByteArray text = snapshot.toOpenMetrics();
+    QVERIFY(text.contains("packagekitqt_packages_emitted_total 10\n"));
+    QVERIFY(text.endsWith("# EOF\n"));
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("packagekitqt.prom"));
+    QVERIFY(Metrics::writeOpenMetrics(fileName));
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCOMPARE(file.readAll(), text);
+}
+
+void TransactionTest::tracing()
+{
+    if (!Tracing::isAvailable()) {
+        QSKIP("Built without tracing support");
+    }
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("trace.json"));
+
+    QVERIFY(Tracing::start(fileName));
+    QVERIFY(Tracing::isActive());
+    QCOMPARE(waitFinished(Daemon::getPackages()), Transaction::ExitSuccess);
+    Tracing::stop();
+    QVERIFY(!Tracing::isActive());
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QJsonParseError error;
+    const QJsonArray events = QJsonDocument::fromJson(file.readAll(), &error).array();
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    QSet<QString> names;
+    for (const QJsonValue &event : events) {
+        names.insert(event.toObject().value(QLatin1String("name")).toString());
+    }
+    QVERIFY(names.contains(QStringLiteral("Transaction")));
+    QVERIFY(names.contains(QStringLiteral("Transaction::runQueuedTransaction")));
+    QVERIFY(names.contains(QStringLiteral("Transaction::Packages")));
+}
+
+void TransactionTest::recordReplay()
+{
+    QVERIFY(m_fake.configure({ { QStringLiteral("packages"), 100u } }));
+
+    TransactionRecorder recorder;
+    QStringList packageIds;
+    Transaction *transaction = Daemon::getPackages();
+    recorder.record(transaction);
+    connect(transaction, &Transaction::package,
+            this, [&packageIds] (Transaction::Info, const QString &packageID) {
+        packageIds.append(packageID);
+    });
+    QCOMPARE(waitFinished(transaction), Transaction::ExitSuccess);
+    QVERIFY(!recorder.isRecording());
+    QVERIFY(recorder.eventCount() > 0);
+    QCOMPARE(packageIds.size(), 100);
+
+    TransactionReplayer replayer;
+    QVERIFY(!replayer.load(QByteArray("garbage")));
+    QVERIFY2(replayer.load(recorder.data()), qPrintable(replayer.errorString()));
+    QCOMPARE(replayer.role(), Transaction::RoleGetPackages);
+    QCOMPARE(replayer.eventCount(), recorder.eventCount());
+
+    for (TransactionReplayer::Speed speed : { TransactionReplayer::SpeedMaximum, TransactionReplayer::SpeedOriginal }) {
+        QStringList replayedIds;
+        QPointer<Transaction> replayed = replayer.replay(speed);
+        QVERIFY(replayed);
+        connect(replayed, &Transaction::package,
+                this, [&replayedIds] (Transaction::Info, const QString &packageID) {
+            replayedIds.append(packageID);
+        });
+        QCOMPARE(waitFinished(replayed), Transaction::ExitSuccess);
+        QCOMPARE(replayed->role(), Transaction::RoleGetPackages);
+        QCOMPARE(replayedIds, packageIds);
+        QTRY_VERIFY(!replayed);
+    }
+
+    // A truncated recording still ends the transaction
+    QVERIFY2(replayer.load(recorder.data().first(recorder.data().size() / 2)), qPrintable(replayer.errorString()));
+    QPointer<Transaction> truncated = replayer.replay(TransactionReplayer::SpeedMaximum);
+    QVERIFY(truncated);
+    QSignalSpy errorCode(truncated, &Transaction::errorCode);
+    QCOMPARE(waitFinished(truncated), Transaction::ExitFailed);
+    QCOMPARE(errorCode.size(), 1);
+    QCOMPARE(errorCode.constFirst().constFirst().value<Transaction::Error>(), Transaction::ErrorInternalError);
+    QTRY_VERIFY(!truncated);
+}
+
+void TransactionTest::updateTracker()
+{
+    QVERIFY(m_fake.configure({ { QStringLiteral("updates"), 5u } }));
+
+    UpdateTracker tracker;
+    QSignalSpy refreshed(&tracker, &UpdateTracker::refreshed);
+    QSignalSpy added(&tracker, &UpdateTracker::added);
+    QSignalSpy removed(&tracker, &UpdateTracker::removed);
+    QSignalSpy updateDetail(&tracker, &UpdateTracker::updateDetail);
+    QSignalSpy updateDetails(&tracker, &UpdateTracker::updateDetails);
+
+    QVERIFY(refreshed.wait());
+    QCOMPARE(tracker.count(), 5);
+    QCOMPARE(added.size(), 1);
+    QCOMPARE(updateDetail.size(), 5);
+    QCOMPARE(updateDetails.size(), 1);
+    QCOMPARE(updateDetails.constFirst().constFirst().value<QList<UpdateDetail>>().size(), 5);
+
+    // Only the new updates get their details fetched
+    QVERIFY(m_fake.configure({ { QStringLiteral("updates"), 8u } }));
+    QVERIFY(m_fake.emitUpdatesChanged());
+    QVERIFY(refreshed.wait());
+    QCOMPARE(tracker.count(), 8);
+    QCOMPARE(added.size(), 2);
+    QCOMPARE(added.constLast().constFirst().toStringList().size(), 3);
+    QCOMPARE(updateDetail.size(), 8);
+
+    QVERIFY(m_fake.configure({ { QStringLiteral("updates"), 6u } }));
+    QVERIFY(m_fake.emitUpdatesChanged());
+    QVERIFY(refreshed.wait());
+    QCOMPARE(tracker.count(), 6);
+    QCOMPARE(removed.size(), 1);
+    QCOMPARE(removed.constFirst().constFirst().toStringList().size(), 2);
+    QVERIFY(!tracker.contains(FakeConfig::updateId(7)));
+
+    // Details that failed to arrive are asked for again on the next refresh
+    QSignalSpy errorCode(&tracker, &UpdateTracker::errorCode);
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("updates"), 9u },
+        { QStringLiteral("failingRole"), uint(Transaction::RoleGetUpdateDetail) },
+    }));
+    QVERIFY(m_fake.emitUpdatesChanged());
+    QVERIFY(refreshed.wait());
+    QCOMPARE(tracker.count(), 9);
+    QCOMPARE(errorCode.size(), 1);
+    QCOMPARE(updateDetail.size(), 8);
+
+    QVERIFY(m_fake.configure({ { QStringLiteral("failingRole"), 0u } }));
+    QVERIFY(m_fake.emitUpdatesChanged());
+    QVERIFY(refreshed.wait());
+    QCOMPARE(added.size(), 3);
+    QCOMPARE(updateDetail.size(), 11);
+    QSet<QString> retried;
+    for (qsizetype i = 8; i < updateDetail.size(); ++i) {
+        retried.insert(updateDetail.at(i).constFirst().toString());
+    }
+    QCOMPARE(retried, QSet<QString>({ FakeConfig::updateId(6), FakeConfig::updateId(7), FakeConfig::updateId(8) }));
+}
+
+void TransactionTest::transactionHistory()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("history"));
+
+    QVERIFY(m_fake.configure({ { QStringLiteral("oldTransactions"), 30u } }));
+    {
+        TransactionHistory history(fileName);
+        history.setWindowSize(4);
+        QSignalSpy synced(&history, &TransactionHistory::synced);
+        history.sync();
+        QVERIFY(synced.wait());
+        QCOMPARE(synced.constFirst().constFirst().toInt(), 30);
+        QCOMPARE(history.records().constFirst().tid().path(), FakeConfig::oldTransactionTid(0));
+    }
+
+    QVERIFY(m_fake.configure({ { QStringLiteral("oldTransactions"), 33u } }));
+    TransactionHistory history(fileName);
+    QCOMPARE(history.count(), 30);
+
+    history.setWindowSize(4);
+    QSignalSpy synced(&history, &TransactionHistory::synced);
+    history.sync();
+    QVERIFY(synced.wait());
+    QCOMPARE(synced.constFirst().constFirst().toInt(), 3);
+    QCOMPARE(history.count(), 33);
+    QCOMPARE(history.records().constLast().tid().path(), FakeConfig::oldTransactionTid(32));
+}
+
+void TransactionTest::transactionHistoryReset_data()
+{
+    QTest::addColumn<QByteArray>("contents");
+
+    QTest::newRow("short") << QByteArray("PKH", 3);
+    QTest::newRow("foreign") << QByteArray("not a history file at all");
+}
+
+void TransactionTest::transactionHistoryReset()
+{
+    QFETCH(QByteArray, contents);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("history"));
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(contents), contents.size());
+    file.close();
+
+    QVERIFY(m_fake.configure({ { QStringLiteral("oldTransactions"), 30u } }));
+    {
+        TransactionHistory history(fileName);
+        QCOMPARE(history.count(), 0);
+        QSignalSpy synced(&history, &TransactionHistory::synced);
+        history.sync();
+        QVERIFY(synced.wait());
+        QCOMPARE(synced.constFirst().constFirst().toInt(), 30);
+    }
+
+    // What was fetched can be read back
+    TransactionHistory history(fileName);
+    QCOMPARE(history.count(), 30);
+    QCOMPARE(history.records().constFirst().tid().path(), FakeConfig::oldTransactionTid(0));
+}
+
+void TransactionTest::fileOwnerIndex()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("owners"));
+
+    QVERIFY(m_fake.configure({ { QStringLiteral("packages"), 20u } }));
+    FileOwnerIndex index(fileName);
+    QVERIFY(!index.isValid());
+    QSignalSpy built(&index, &FileOwnerIndex::built);
+    QVERIFY(built.wait());
+    QVERIFY(index.isValid());
+
+    // Only the even packages are installed
+    QCOMPARE(index.packageCount(), 10);
+    QCOMPARE(index.fileCount(), 30);
+    QCOMPARE(index.owner(FakeConfig::fileName(2, 1)), FakeConfig::packageId(2));
+    QCOMPARE(index.owners(FakeConfig::fileName(18, 2)), QStringList{ FakeConfig::packageId(18) });
+    QVERIFY(index.owner(FakeConfig::fileName(3, 0)).isEmpty());
+    QVERIFY(!index.contains(QStringLiteral("/usr/share/")));
+    QVERIFY(!index.contains(FakeConfig::fileName(2, 1) + QLatin1Char('0')));
+
+    // Answers right away from the stored index
+    FileOwnerIndex stored(fileName);
+    stored.setAutoRebuild(false);
+    QVERIFY(stored.isValid());
+    QCOMPARE(stored.fileCount(), 30);
+    QCOMPARE(stored.owner(FakeConfig::fileName(4, 0)), FakeConfig::packageId(4));
+
+    // A package update shows up in the history
+    QVERIFY(m_fake.configure({
+        { QStringLiteral("packages"), 20u },
+        { QStringLiteral("oldTransactions"), 12u },
+    }));
+    QSignalSpy invalidated(&stored, &FileOwnerIndex::invalidated);
+    QVERIFY(m_fake.emitUpdatesChanged());
+    QVERIFY(invalidated.wait());
+    QVERIFY(!stored.isValid());
+    QVERIFY(!stored.isBuilding());
+    QCOMPARE(stored.owner(FakeConfig::fileName(4, 0)), FakeConfig::packageId(4));
+
+    // The other one rebuilds on its own
+    QTRY_COMPARE(built.size(), 2);
+    QVERIFY(index.isValid());
+}
+
+void TransactionTest::daemonRestart()
+{
+    QTRY_VERIFY(Daemon::isRunning());
+
+    QSignalSpy daemonQuit(Daemon::global(), &Daemon::daemonQuit);
+    QVERIFY(m_fake.quit());
+    QVERIFY(daemonQuit.wait());
+    QTRY_VERIFY(!Daemon::isRunning());
+
+    QVERIFY2(m_fake.start(), qPrintable(m_fake.errorString()));
+    QTRY_VERIFY(Daemon::isRunning());
+}
+
+QTEST_GUILESS_MAIN(TransactionTest)
+
+#include "transactiontest.moc"
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <QTest>
+
+#include <versioncompare.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace PackageKit;
+
+// Pure logic, runs without the fake daemon
+class VersionCompareTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void versionCompare_data();
+    void versionCompare();
+};
+
+void VersionCompareTest::versionCompare_data()
+{
+    QTest::addColumn<bool>("dpkg");
+    QTest::addColumn<QString>("a");
+    QTest::addColumn<QString>("b");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("rpm-equal") << false << QStringLiteral("1.0") << QStringLiteral("1.0") << 0;
+    QTest::newRow("rpm-older") << false << QStringLiteral("1.0") << QStringLiteral("2.0") << -1;
+    QTest::newRow("rpm-more-segments") << false << QStringLiteral("2.0.1") << QStringLiteral("2.0") << 1;
+    QTest::newRow("rpm-trailing-alpha") << false << QStringLiteral("2.0.1a") << QStringLiteral("2.0.1") << 1;
+    QTest::newRow("rpm-alpha-number") << false << QStringLiteral("5.5p1") << QStringLiteral("5.5p2") << -1;
+    QTest::newRow("rpm-numeric-length") << false << QStringLiteral("5.5p10") << QStringLiteral("5.5p1") << 1;
+    QTest::newRow("rpm-number-beats-alpha") << false << QStringLiteral("10.1xyz") << QStringLiteral("10xyz") << 1;
+    QTest::newRow("rpm-alpha-vs-number") << false << QStringLiteral("xyz.4") << QStringLiteral("8") << -1;
+    QTest::newRow("rpm-longer-alpha") << false << QStringLiteral("1.0aa") << QStringLiteral("1.0a") << 1;
+    QTest::newRow("rpm-separators") << false << QStringLiteral("2.0") << QStringLiteral("2_0") << 0;
+    QTest::newRow("rpm-leading-zeros") << false << QStringLiteral("1.01") << QStringLiteral("1.1") << 0;
+    QTest::newRow("rpm-leading-zeros-value") << false << QStringLiteral("1.010") << QStringLiteral("1.1") << 1;
+    QTest::newRow("rpm-tilde") << false << QStringLiteral("1.0~rc1") << QStringLiteral("1.0") << -1;
+    QTest::newRow("rpm-tilde-tilde") << false << QStringLiteral("1.0~rc1") << QStringLiteral("1.0~rc2") << -1;
+    QTest::newRow("rpm-double-tilde") << false << QStringLiteral("1.0~rc1~git123") << QStringLiteral("1.0~rc1") << -1;
+    QTest::newRow("rpm-caret") << false << QStringLiteral("1.0^git1") << QStringLiteral("1.0") << 1;
+    QTest::newRow("rpm-caret-vs-segment") << false << QStringLiteral("1.0^git1") << QStringLiteral("1.01") << -1;
+    QTest::newRow("rpm-caret-caret") << false << QStringLiteral("1.0^git1") << QStringLiteral("1.0^git2") << -1;
+    QTest::newRow("rpm-caret-tilde") << false << QStringLiteral("1.0^git1~pre") << QStringLiteral("1.0^git1") << -1;
+    QTest::newRow("rpm-tilde-caret") << false << QStringLiteral("1.0~rc1^git1") << QStringLiteral("1.0~rc1") << 1;
+    QTest::newRow("rpm-epoch") << false << QStringLiteral("1:1.0") << QStringLiteral("2.0") << 1;
+    QTest::newRow("rpm-epoch-zero") << false << QStringLiteral("0:1.0") << QStringLiteral("1.0") << 0;
+    QTest::newRow("rpm-epoch-order") << false << QStringLiteral("2:1.0") << QStringLiteral("1:9.9") << 1;
+    QTest::newRow("rpm-release") << false << QStringLiteral("1.0-10") << QStringLiteral("1.0-9") << 1;
+    QTest::newRow("rpm-release-tilde") << false << QStringLiteral("1.0-1~beta") << QStringLiteral("1.0-1") << -1;
+    QTest::newRow("dpkg-equal") << true << QStringLiteral("1.0") << QStringLiteral("1.0") << 0;
+    QTest::newRow("dpkg-more-segments") << true << QStringLiteral("1.0.1") << QStringLiteral("1.0") << 1;
+    QTest::newRow("dpkg-tilde") << true << QStringLiteral("1.0~rc1") << QStringLiteral("1.0") << -1;
+    QTest::newRow("dpkg-double-tilde") << true << QStringLiteral("1.0~~") << QStringLiteral("1.0~~a") << -1;
+    QTest::newRow("dpkg-tilde-alpha") << true << QStringLiteral("1.0~~a") << QStringLiteral("1.0~") << -1;
+    QTest::newRow("dpkg-tilde-end") << true << QStringLiteral("1.0~") << QStringLiteral("1.0") << -1;
+    QTest::newRow("dpkg-end-alpha") << true << QStringLiteral("1.0") << QStringLiteral("1.0a") << -1;
+    QTest::newRow("dpkg-alpha-symbol") << true << QStringLiteral("1.0a") << QStringLiteral("1.0+") << -1;
+    QTest::newRow("dpkg-symbols") << true << QStringLiteral("1.0.0") << QStringLiteral("1.0+1") << 1;
+    QTest::newRow("dpkg-caret") << true << QStringLiteral("1.0^1") << QStringLiteral("1.0") << 1;
+    QTest::newRow("dpkg-leading-zeros") << true << QStringLiteral("1.001") << QStringLiteral("1.1") << 0;
+    QTest::newRow("dpkg-numeric-length") << true << QStringLiteral("1.10") << QStringLiteral("1.9") << 1;
+    QTest::newRow("dpkg-epoch") << true << QStringLiteral("1:0.1") << QStringLiteral("2.0") << 1;
+    QTest::newRow("dpkg-epoch-zero") << true << QStringLiteral("0:1.0") << QStringLiteral("1.0") << 0;
+    QTest::newRow("dpkg-revision") << true << QStringLiteral("1.0-1ubuntu1") << QStringLiteral("1.0-1") << 1;
+    QTest::newRow("dpkg-revision-tilde") << true << QStringLiteral("1.0-1~bpo1") << QStringLiteral("1.0-1") << -1;
+    QTest::newRow("dpkg-zero-empty") << true << QStringLiteral("0") << QString() << 0;
+}
+
+void VersionCompareTest::versionCompare()
+{
+    QFETCH(bool, dpkg);
+    QFETCH(QString, a);
+    QFETCH(QString, b);
+    QFETCH(int, expected);
+    const VersionCompare::Scheme scheme = dpkg ? VersionCompare::SchemeDpkg : VersionCompare::SchemeRpm;
+
+    auto sign = [] (qint64 value) {
+        return value < 0 ? -1 : (value > 0 ? 1 : 0);
+    };
+    QCOMPARE(sign(VersionCompare::compare(a, b, scheme)), expected);
+    QCOMPARE(sign(VersionCompare::compare(b, a, scheme)), -expected);
+
+    // The keys must order exactly like compare()
+    const QByteArray keyA = VersionCompare::sortKey(a, scheme);
+    const QByteArray keyB = VersionCompare::sortKey(b, scheme);
+    int rc = std::memcmp(keyA.constData(), keyB.constData(), size_t(std::min(keyA.size(), keyB.size())));
+    if (rc == 0) {
+        rc = sign(keyA.size() - keyB.size());
+    }
+    QCOMPARE(sign(rc), expected);
+}
+
+QTEST_GUILESS_MAIN(VersionCompareTest)
+
+#include "versioncomparetest.moc"
@@ -0,0 +1,398 @@
+/*
+ * This file is part of the PackageKitQt project
+ * Copyright (C) 2026 PackageKit-Qt contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB. If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Fires a mix of transactions at PackageKit with a bounded concurrency
+ * and an optional rate, then reports latency percentiles, throughput and
+ * the CPU time the client spent. Only the public library API is used,
+ * against the system daemon or the fake one from tests/fakepackagekit.
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <QTimer>
+
+#include <daemon.h>
+#include <transaction.h>
+
+#include "fakepackagekit.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+using namespace PackageKit;
+
+namespace {
+
+struct Role
+{
+    QString name;
+    int weight = 1;
+    std::function<Transaction *(uint index)> start;
+};
+
+struct Stats
+{
+    QList<qint64> latencies; // nanoseconds
+    int failures = 0;
+};
+
+double cpuSeconds(const timeval &time)
+{
+    return time.tv_sec + time.tv_usec / 1e6;
+}
+
+// Nearest-rank percentile of sorted values, in milliseconds
+double percentile(const QList<qint64> &sorted, double p)
+{
+    if (sorted.isEmpty()) {
+        return 0;
+    }
+    const int rank = qBound(1, int(std::ceil(p / 100 * sorted.size())), int(sorted.size()));
+    return sorted.at(rank - 1) / 1e6;
+}
+
+QJsonObject statsToJson(const Stats &stats, double seconds)
+{
+    QList<qint64> sorted = stats.latencies;
+    std::sort(sorted.begin(), sorted.end());
+    return QJsonObject{
+        { QStringLiteral("transactions"), int(sorted.size()) },
+        { QStringLiteral("failures"), stats.failures },
+        { QStringLiteral("throughput"), seconds > 0 ? sorted.size() / seconds : 0 },
+        { QStringLiteral("p50"), percentile(sorted, 50) },
+        { QStringLiteral("p95"), percentile(sorted, 95) },
+        { QStringLiteral("p99"), percentile(sorted, 99) },
+        { QStringLiteral("max"), sorted.isEmpty() ? 0 : sorted.constLast() / 1e6 },
+    };
+}
+
+class LoadGenerator
+{
+public:
+    LoadGenerator(const QList<Role> &roles, int concurrency, double rate, int count, int duration)
+        : m_roles(roles)
+        , m_concurrency(concurrency)
+        , m_rate(rate)
+        , m_count(count)
+        , m_duration(duration)
+    {
+        for (const Role &role : m_roles) {
+            m_totalWeight += role.weight;
+        }
+        m_stats.resize(m_roles.size());
+    }
+
+    void run()
+    {
+        QEventLoop loop;
+        m_loop = &loop;
+
+        // With a rate the timer paces the transactions, otherwise
+        // a new one starts whenever one finishes
+        QTimer pacer;
+        pacer.setTimerType(Qt::PreciseTimer);
+        pacer.setInterval(qMax(1, int(1000 / qMax(m_rate, 1.0))));
+        QObject::connect(&pacer, &QTimer::timeout, [this] { fill(); });
+
+        getrusage(RUSAGE_SELF, &m_usageStart);
+        m_clock.start();
+        if (m_rate > 0) {
+            pacer.start();
+        }
+        fill();
+        loop.exec();
+        m_elapsed = m_clock.nsecsElapsed() / 1e9;
+        getrusage(RUSAGE_SELF, &m_usageEnd);
+        m_loop = nullptr;
+    }
+
+    QJsonObject report() const
+    {
+        Stats total;
+        QJsonObject roles;
+        for (int i = 0; i < m_roles.size(); ++i) {
+            total.latencies += m_stats.at(i).latencies;
+            total.failures += m_stats.at(i).failures;
+            roles.insert(m_roles.at(i).name, statsToJson(m_stats.at(i), m_elapsed));
+        }
+
+        QJsonObject result = statsToJson(total, m_elapsed);
+        result.insert(QStringLiteral("seconds"), m_elapsed);
+        result.insert(QStringLiteral("concurrency"), m_concurrency);
+        result.insert(QStringLiteral("rate"), m_rate);
+        result.insert(QStringLiteral("behindSchedule"), m_behind);
+        result.insert(QStringLiteral("cpuUser"), cpuSeconds(m_usageEnd.ru_utime) - cpuSeconds(m_usageStart.ru_utime));
+        result.insert(QStringLiteral("cpuSystem"), cpuSeconds(m_usageEnd.ru_stime) - cpuSeconds(m_usageStart.ru_stime));
+        result.insert(QStringLiteral("roles"), roles);
+        return result;
+    }
+
+private:
+    bool done() const
+    {
+        if (m_count > 0) {
+            return m_started >= m_count;
+        }
+        return m_clock.elapsed() >= qint64(m_duration) * 1000;
+    }
+
+    void fill()
+    {
+        if (done()) {
+            if (m_inFlight == 0) {
+                m_loop->quit();
+            }
+            return;
+        }
+
+        int due = m_concurrency;
+        if (m_rate > 0) {
+            due = int(m_clock.nsecsElapsed() / 1e9 * m_rate) + 1 - m_started;
+            if (due > m_concurrency - m_inFlight) {
+                // The daemon does not keep up with the requested rate
+                m_behind = true;
+            }
+        }
+
+        while (due-- > 0 && m_inFlight < m_concurrency && !done()) {
+            startOne();
+        }
+    }
+
+    void startOne()
+    {
+        int pick = QRandomGenerator::global()->bounded(m_totalWeight);
+        int roleIndex = 0;
+        while (pick >= m_roles.at(roleIndex).weight) {
+            pick -= m_roles.at(roleIndex).weight;
+            ++roleIndex;
+        }
+
+        const qint64 started = m_clock.nsecsElapsed();
+        Transaction *transaction = m_roles.at(roleIndex).start(m_started++);
+        ++m_inFlight;
+        QObject::connect(transaction, &Transaction::finished,
+                         [this, roleIndex, started] (Transaction::Exit status) {
+            Stats &stats = m_stats[roleIndex];
+            stats.latencies.append(m_clock.nsecsElapsed() - started);
+            if (status != Transaction::ExitSuccess) {
+                ++stats.failures;
+            }
+            --m_inFlight;
+            if (m_rate <= 0 || done()) {
+                fill();
+            }
+        });
+    }
+
+    QList<Role> m_roles;
+    QList<Stats> m_stats;
+    QEventLoop *m_loop = nullptr;
+    QElapsedTimer m_clock;
+    rusage m_usageStart = {};
+    rusage m_usageEnd = {};
+    double m_elapsed = 0;
+    const int m_concurrency;
+    const double m_rate;
+    const int m_count;
+    const int m_duration;
+    int m_totalWeight = 0;
+    int m_started = 0;
+    int m_inFlight = 0;
+    bool m_behind = false;
+};
+
+// Resolves the names once to get package IDs for the roles taking them
+QStringList resolvePackageIds(const QStringList &names)
+{
+    QStringList packageIds;
+    Transaction *transaction = Daemon::resolve(names);
+    QObject::connect(transaction, &Transaction::package,
+                     [&packageIds] (Transaction::Info, const QString &packageID) {
+        packageIds.append(packageID);
+    });
+    QEventLoop loop;
+    QObject::connect(transaction, &Transaction::finished, &loop, &QEventLoop::quit);
+    loop.exec();
+    return packageIds;
+}
+
+void printReport(const QJsonObject &report)
+{
+    QTextStream out(stdout);
+    auto line = [&out] (const QString &name, const QJsonObject &stats) {
+        out << qSetFieldWidth(14) << Qt::left << name << qSetFieldWidth(0)
+            << stats.value(QLatin1String("transactions")).toInt() << " done, "
+            << stats.value(QLatin1String("failures")).toInt() << " failed, "
+            << stats.value(QLatin1String("throughput")).toDouble() << "/s, "
+            << "p50 " << stats.value(QLatin1String("p50")).toDouble() << " ms, "
+            << "p95 " << stats.value(QLatin1String("p95")).toDouble() << " ms, "
+            << "p99 " << stats.value(QLatin1String("p99")).toDouble() << " ms\n";
+    };
+
+    const QJsonObject roles = report.value(QLatin1String("roles")).toObject();
+    for (auto it = roles.constBegin(); it != roles.constEnd(); ++it) {
+        line(it.key(), it.value().toObject());
+    }
+    line(QStringLiteral("total"), report);
+    out << "Ran for " << report.value(QLatin1String("seconds")).toDouble() << " s, client CPU "
+        << report.value(QLatin1String("cpuUser")).toDouble() << " s user, "
+        << report.value(QLatin1String("cpuSystem")).toDouble() << " s system\n";
+    if (report.value(QLatin1String("behindSchedule")).toBool()) {
+        out << "The requested rate could not be kept at this concurrency\n";
+    }
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("pkqt-loadgen"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Stress PackageKit with concurrent transactions"));
+    parser.addHelpOption();
+
+    QCommandLineOption rolesOption(QStringLiteral("roles"),
+                                   QStringLiteral("Weighted mix of resolve, getDetails, getFiles, searchNames, "
+                                                  "getPackages and getUpdates, e.g. resolve=3,getDetails=1."),
+                                   QStringLiteral("mix"),
+                                   QStringLiteral("resolve=1,getDetails=1"));
+    QCommandLineOption concurrencyOption({ QStringLiteral("c"), QStringLiteral("concurrency") },
+                                         QStringLiteral("Transactions in flight at most."),
+                                         QStringLiteral("n"),
+                                         QStringLiteral("4"));
+    QCommandLineOption rateOption({ QStringLiteral("r"), QStringLiteral("rate") },
+                                  QStringLiteral("Transactions started per second, 0 for as fast as possible."),
+                                  QStringLiteral("rate"),
+                                  QStringLiteral("0"));
+    QCommandLineOption countOption({ QStringLiteral("n"), QStringLiteral("count") },
+                                   QStringLiteral("Number of transactions to run."),
+                                   QStringLiteral("n"),
+                                   QStringLiteral("100"));
+    QCommandLineOption durationOption({ QStringLiteral("d"), QStringLiteral("duration") },
+                                      QStringLiteral("Run for <seconds> instead of a number of transactions."),
+                                      QStringLiteral("seconds"));
+    QCommandLineOption namesOption(QStringLiteral("names"),
+                                   QStringLiteral("Comma separated package names used by the roles."),
+                                   QStringLiteral("names"),
+                                   QStringLiteral("bash,coreutils,glibc"));
+    QCommandLineOption fakeOption(QStringLiteral("fake"),
+                                  QStringLiteral("Run against the fake daemon on a private bus instead of the system daemon."));
+    QCommandLineOption fakeConfigOption(QStringLiteral("fake-config"),
+                                        QStringLiteral("Comma separated FakeConfig settings, e.g. packages=10000,chunkSize=64."),
+                                        QStringLiteral("settings"));
+    QCommandLineOption jsonOption(QStringLiteral("json"),
+                                  QStringLiteral("Also write the report to <file> as JSON."),
+                                  QStringLiteral("file"));
+    parser.addOptions({ rolesOption, concurrencyOption, rateOption, countOption, durationOption,
+                        namesOption, fakeOption, fakeConfigOption, jsonOption });
+    parser.process(app);
+
+    const int concurrency = parser.value(concurrencyOption).toInt();
+    const double rate = parser.value(rateOption).toDouble();
+    const int duration = parser.value(durationOption).toInt();
+    const int count = parser.isSet(durationOption) ? 0 : parser.value(countOption).toInt();
+    if (concurrency < 1 || rate < 0 || (count < 1 && duration < 1)) {
+        qCritical("Concurrency and count or duration must be positive");
+        return 1;
+    }
+
+    FakePackageKit fake;
+    QStringList names = parser.value(namesOption).split(QLatin1Char(','), Qt::SkipEmptyParts);
+    if (parser.isSet(fakeOption)) {
+        QVariantMap config;
+        for (const QString &setting : parser.value(fakeConfigOption).split(QLatin1Char(','), Qt::SkipEmptyParts)) {
+            config.insert(setting.section(QLatin1Char('='), 0, 0), setting.section(QLatin1Char('='), 1));
+        }
+        if (!fake.start(config)) {
+            qCritical("%s", qPrintable(fake.errorString()));
+            return 1;
+        }
+        if (!parser.isSet(namesOption)) {
+            names = { FakeConfig::packageName(0), FakeConfig::packageName(1), FakeConfig::packageName(2) };
+        }
+    }
+
+    const QStringList packageIds = resolvePackageIds(names);
+    if (packageIds.isEmpty()) {
+        qCritical("None of the packages %s could be resolved", qPrintable(names.join(QLatin1String(", "))));
+        return 1;
+    }
+
+    const QList<Role> known = {
+        { QStringLiteral("resolve"), 1, [names] (uint i) { return Daemon::resolve(names.at(i % names.size())); } },
+        { QStringLiteral("getDetails"), 1, [packageIds] (uint i) { return Daemon::getDetails(packageIds.at(i % packageIds.size())); } },
+        { QStringLiteral("getFiles"), 1, [packageIds] (uint i) { return Daemon::getFiles(packageIds.at(i % packageIds.size())); } },
+        { QStringLiteral("searchNames"), 1, [names] (uint i) { return Daemon::searchNames(names.at(i % names.size())); } },
+        { QStringLiteral("getPackages"), 1, [] (uint) { return Daemon::getPackages(); } },
+        { QStringLiteral("getUpdates"), 1, [] (uint) { return Daemon::getUpdates(); } },
+    };
+
+    QList<Role> roles;
+    for (const QString &entry : parser.value(rolesOption).split(QLatin1Char(','), Qt::SkipEmptyParts)) {
+        const QString name = entry.section(QLatin1Char('='), 0, 0);
+        auto it = std::find_if(known.cbegin(), known.cend(), [&name] (const Role &role) {
+            return role.name == name;
+        });
+        if (it == known.cend()) {
+            qCritical("Unknown role %s", qPrintable(name));
+            return 1;
+        }
+        Role role = *it;
+        role.weight = entry.contains(QLatin1Char('=')) ? entry.section(QLatin1Char('='), 1).toInt() : 1;
+        if (role.weight > 0) {
+            roles.append(role);
+        }
+    }
+    if (roles.isEmpty()) {
+        qCritical("No roles to run");
+        return 1;
+    }
+
+    LoadGenerator generator(roles, concurrency, rate, count, duration);
+    generator.run();
+
+    const QJsonObject report = generator.report();
+    printReport(report);
+    if (parser.isSet(jsonOption)) {
+        QFile file(parser.value(jsonOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qCritical("Could not write %s: %s", qPrintable(file.fileName()), qPrintable(file.errorString()));
+            return 1;
+        }
+        file.write(QJsonDocument(report).toJson());
+    }
+
+    return report.value(QLatin1String("failures")).toInt() > 0 ? 2 : 0;
+}